@@ -0,0 +1,190 @@
+#include "AsyncLogWriter.h"
+
+#include <cstring>
+#include <chrono>
+
+using namespace std;
+
+AsyncLogWriter::AsyncLogWriter()
+  : m_head(0)
+  , m_tail(0)
+  , m_isClosing(false)
+  , m_droppedCount(0)
+{
+  m_isOpen = false;
+  m_policy = LOG_POLICY_BLOCK;
+  m_ring = NULL;
+
+  // nothing is gathered until the file is open
+  setp(NULL, NULL);
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+  close();
+}
+
+bool AsyncLogWriter::open(const string& filename, const bool isBinary, const int policy) {
+  close();
+
+  m_file.open(filename, isBinary ? ios::out | ios::binary : ios::out);
+  if (m_file.fail()) {
+    m_file.close();
+    return false;
+  }
+
+  if (m_ring == NULL) {
+    m_ring = new char[LOG_RING_SIZE];
+  }
+
+  m_policy = policy;
+  m_head = 0;
+  m_tail = 0;
+  m_isClosing = false;
+  m_droppedCount = 0;
+  m_isOpen = true;
+
+  setp(m_chunk, m_chunk + LOG_CHUNK_SIZE);
+  m_writer = thread(&__this::writeRing, this);
+
+  return true;
+}
+
+void AsyncLogWriter::close() {
+  if (!m_isOpen) {
+    return;
+  }
+
+  publishChunk();
+  setp(NULL, NULL);
+
+  m_isClosing = true;
+  m_writer.join();
+
+  m_file.close();
+  m_isOpen = false;
+
+  delete[] m_ring;
+  m_ring = NULL;
+}
+
+bool AsyncLogWriter::is_open() const {
+  return m_isOpen;
+}
+
+unsigned long long AsyncLogWriter::getDroppedCount() const {
+  return m_droppedCount;
+}
+
+int AsyncLogWriter::overflow(int c) {
+  // a closed log discards what is written to it
+  if (!m_isOpen) {
+    return c == EOF ? 0 : c;
+  }
+
+  publishChunk();
+
+  if (c != EOF) {
+    *pptr() = (char)c;
+    pbump(1);
+  }
+
+  return c == EOF ? 0 : c;
+}
+
+streamsize AsyncLogWriter::xsputn(const char* s, streamsize n) {
+  streamsize numWritten = 0;
+  streamsize numFree;
+
+  if (!m_isOpen) {
+    return n;
+  }
+
+  while (numWritten < n) {
+    numFree = epptr() - pptr();
+    if (numFree == 0) {
+      publishChunk();
+      numFree = epptr() - pptr();
+    }
+    if (numFree > n - numWritten) {
+      numFree = n - numWritten;
+    }
+
+    memcpy(pptr(), s + numWritten, (size_t)numFree);
+    pbump((int)numFree);
+    numWritten += numFree;
+  }
+
+  return n;
+}
+
+int AsyncLogWriter::sync() {
+  return 0;
+}
+
+void AsyncLogWriter::publishChunk() {
+  unsigned long long size = (unsigned long long)(pptr() - pbase());
+  unsigned long long head = m_head.load(memory_order_relaxed);
+  unsigned long long offset;
+  unsigned long long numFirst;
+
+  if (size == 0) {
+    return;
+  }
+
+  while (head + size - m_tail.load(memory_order_acquire) > LOG_RING_SIZE) {
+    if (m_policy == LOG_POLICY_DROP) {
+      m_droppedCount += size;
+      setp(m_chunk, m_chunk + LOG_CHUNK_SIZE);
+      return;
+    }
+    this_thread::yield();
+  }
+
+  // the chunk may wrap around the end of the ring
+  offset = head & (LOG_RING_SIZE - 1);
+  numFirst = LOG_RING_SIZE - offset;
+  if (numFirst > size) {
+    numFirst = size;
+  }
+  memcpy(m_ring + offset, m_chunk, (size_t)numFirst);
+  memcpy(m_ring, m_chunk + numFirst, (size_t)(size - numFirst));
+
+  m_head.store(head + size, memory_order_release);
+  setp(m_chunk, m_chunk + LOG_CHUNK_SIZE);
+}
+
+void AsyncLogWriter::writeRing() {
+  unsigned long long tail = m_tail.load(memory_order_relaxed);
+  unsigned long long head;
+  unsigned long long offset;
+  unsigned long long numFirst;
+  bool isClosing;
+
+  while (true) {
+    // read before the head, so that nothing published before closing is missed
+    isClosing = m_isClosing.load(memory_order_acquire);
+    head = m_head.load(memory_order_acquire);
+
+    if (head == tail) {
+      if (isClosing) {
+        break;
+      }
+      this_thread::sleep_for(chrono::microseconds(LOG_WRITER_IDLE_MICROSECONDS));
+      continue;
+    }
+
+    // everything published so far is written as one batch
+    offset = tail & (LOG_RING_SIZE - 1);
+    numFirst = LOG_RING_SIZE - offset;
+    if (numFirst > head - tail) {
+      numFirst = head - tail;
+    }
+    m_file.write(m_ring + offset, (streamsize)numFirst);
+    m_file.write(m_ring, (streamsize)(head - tail - numFirst));
+
+    tail = head;
+    m_tail.store(tail, memory_order_release);
+  }
+
+  m_file.flush();
+}
\ No newline at end of file
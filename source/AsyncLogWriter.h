@@ -0,0 +1,75 @@
+#ifndef ASYNC_LOG_WRITER_H
+#define ASYNC_LOG_WRITER_H
+
+#include <string>
+#include <fstream>
+#include <streambuf>
+#include <thread>
+#include <atomic>
+
+// what is done with a chunk when the writer has fallen behind
+#define LOG_POLICY_BLOCK 0
+#define LOG_POLICY_DROP 1
+
+// bytes gathered before they are handed to the writer
+#define LOG_CHUNK_SIZE (1 << 14)
+// bytes that may wait for the writer (a power of two)
+#define LOG_RING_SIZE (1 << 22)
+
+// how long the writer sleeps when there is nothing to write
+#define LOG_WRITER_IDLE_MICROSECONDS 200
+
+// a stream buffer whose file is written by a background thread
+//   the executing thread gathers chunks and publishes them to a single-producer ring,
+//   which the writer drains in batches, so that a log stream never waits on the disk
+//   (the ring is lock-free; only one thread may write to the stream)
+class AsyncLogWriter : public std::streambuf {
+public:
+  AsyncLogWriter();
+  ~AsyncLogWriter();
+
+  // opens the file and starts the writer
+  //   returns false if the file cannot be opened
+  bool open(const std::string& filename, const bool isBinary = false, const int policy = LOG_POLICY_BLOCK);
+
+  // hands over what is left and waits for the writer to write it
+  void close();
+
+  bool is_open() const;
+
+  // returns the bytes dropped since the file was opened
+  unsigned long long getDroppedCount() const;
+
+protected:
+  int overflow(int c);
+  std::streamsize xsputn(const char* s, std::streamsize n);
+  // a flush does not wait for the disk; the chunk is published once it fills
+  int sync();
+
+private:
+  typedef AsyncLogWriter __this;
+
+  std::ofstream m_file;
+  std::thread m_writer;
+  bool m_isOpen;
+  int m_policy;
+
+  // the chunk being gathered
+  char m_chunk[LOG_CHUNK_SIZE];
+
+  char* m_ring;
+  // total bytes published and written
+  //   (only the executing thread stores m_head, only the writer stores m_tail)
+  std::atomic<unsigned long long> m_head;
+  std::atomic<unsigned long long> m_tail;
+  std::atomic<bool> m_isClosing;
+  std::atomic<unsigned long long> m_droppedCount;
+
+  // moves the chunk into the ring, waiting or dropping it if the ring is full
+  void publishChunk();
+
+  // writes what has been published until the file is closed
+  void writeRing();
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,278 @@
+#include "BatchRunner.h"
+
+#include "SyllableParser.h"
+#include "TokenGenerator.h"
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <filesystem>
+
+using namespace std;
+
+mutex BatchRunner::s_frontEndMutex;
+
+string batchStatusToString(const int status) {
+  switch (status) {
+  case BATCH_STATUS_PENDING:
+    return "PENDING";
+  case BATCH_STATUS_DONE:
+    return "DONE";
+  case BATCH_STATUS_BAD_FORM:
+    return "BAD_FORM";
+  case BATCH_STATUS_NOT_EXECUTABLE:
+    return "NOT_EXECUTABLE";
+  case BATCH_STATUS_NO_INPUT:
+    return "NO_INPUT";
+  case BATCH_STATUS_STEP_BUDGET:
+    return "STEP_BUDGET";
+  case BATCH_STATUS_TIME_BUDGET:
+    return "TIME_BUDGET";
+  case BATCH_STATUS_CANCELLED:
+    return "CANCELLED";
+  case BATCH_STATUS_CYCLE:
+    return "CYCLE";
+  case BATCH_STATUS_MEMORY_BUDGET:
+    return "MEMORY_BUDGET";
+  default:
+    return "INVALID_STATUS";
+  }
+}
+
+//-------------------------------------------------------------------------------
+// BatchRunner::loadJobs()
+//-------------------------------------------------------------------------------
+bool BatchRunner::loadJobs(const string& path, vector<BatchJob>& jobs) {
+  error_code error;
+  ifstream listFile;
+  string line;
+  string programFilename;
+  string inputFilename;
+
+  // every program in the directory
+  if (filesystem::is_directory(path, error)) {
+    vector<string> programFilenames;
+
+    for (const filesystem::directory_entry& entry : filesystem::directory_iterator(path, error)) {
+      if (entry.is_regular_file() && lowerCase(entry.path().extension().string()) == BATCH_PROGRAM_SUFFIX) {
+        programFilenames.push_back(entry.path().string());
+      }
+    }
+    sort(programFilenames.begin(), programFilenames.end());
+
+    for (int i = 0; i < (int)programFilenames.size(); i++) {
+      inputFilename = filesystem::path(programFilenames[i]).replace_extension(BATCH_INPUT_SUFFIX).string();
+      if (!filesystem::exists(inputFilename, error)) {
+        inputFilename = "";
+      }
+      jobs.push_back(BatchJob(programFilenames[i], inputFilename));
+    }
+
+    return true;
+  }
+
+  listFile.open(path);
+  if (!listFile.is_open()) {
+    cout << "Error: \"" << path << "\" is not a directory or a list of programs" << endl;
+    return false;
+  }
+
+  // a program and an optional input file on each line
+  while (getline(listFile, line)) {
+    stringstream lineStream(line);
+
+    programFilename = "";
+    inputFilename = "";
+    lineStream >> programFilename >> inputFilename;
+
+    if (!programFilename.empty()) {
+      jobs.push_back(BatchJob(programFilename, inputFilename));
+    }
+  }
+
+  return true;
+}
+
+//-------------------------------------------------------------------------------
+// BatchRunner::run()
+//-------------------------------------------------------------------------------
+double BatchRunner::run(
+  vector<BatchJob>& jobs
+  , const int threadCount
+  , const long long stepBudget
+  , const double timeBudget
+  , const long long memoryBudget
+  , const bool isSeedFixed
+  , const unsigned long long seed
+  , const bool areCyclesDetected
+  )
+{
+  vector<thread> threads;
+  atomic<int> nextJob(0);
+  int numThreads = threadCount;
+  chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+  if (numThreads <= 0) {
+    numThreads = (int)thread::hardware_concurrency();
+  }
+  if (numThreads > (int)jobs.size()) {
+    numThreads = (int)jobs.size();
+  }
+  if (numThreads < 1) {
+    numThreads = 1;
+  }
+
+  for (int i = 0; i < numThreads; i++) {
+    threads.push_back(thread(runJobs, ref(jobs), ref(nextJob), stepBudget, timeBudget, memoryBudget, isSeedFixed, seed, areCyclesDetected));
+  }
+  for (int i = 0; i < (int)threads.size(); i++) {
+    threads[i].join();
+  }
+
+  return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+//-------------------------------------------------------------------------------
+// BatchRunner::displaySummary()
+//-------------------------------------------------------------------------------
+void BatchRunner::displaySummary(const vector<BatchJob>& jobs, const double seconds, ostream& output) {
+  int numDone = 0;
+
+  output << OUTPUT_LINE << endl;
+  for (int i = 0; i < (int)jobs.size(); i++) {
+    output << batchStatusToString(jobs[i].status)
+      << " " << jobs[i].seconds * 1000.0 << " ms"
+      << " " << jobs[i].executionCount << " executions"
+      << " " << jobs[i].memoryBytes << " bytes"
+      << " seed " << jobs[i].seed
+      << " \"" << jobs[i].programFilename << "\"" << endl;
+
+    if (jobs[i].status == BATCH_STATUS_DONE) {
+      numDone++;
+    }
+  }
+  output << OUTPUT_LINE << endl;
+  output << "Programs executed: " << numDone << " of " << jobs.size() << endl;
+  output << "Wall time: " << seconds * 1000.0 << " ms" << endl;
+}
+
+//-------------------------------------------------------------------------------
+// BatchRunner::runJobs()
+//-------------------------------------------------------------------------------
+void BatchRunner::runJobs(
+  vector<BatchJob>& jobs
+  , atomic<int>& nextJob
+  , const long long stepBudget
+  , const double timeBudget
+  , const long long memoryBudget
+  , const bool isSeedFixed
+  , const unsigned long long seed
+  , const bool areCyclesDetected
+  )
+{
+  for (int i = nextJob++; i < (int)jobs.size(); i = nextJob++) {
+    runJob(jobs[i], stepBudget, timeBudget, memoryBudget, isSeedFixed, seed, areCyclesDetected);
+  }
+}
+
+//-------------------------------------------------------------------------------
+// BatchRunner::runJob()
+//-------------------------------------------------------------------------------
+void BatchRunner::runJob(
+  BatchJob& job
+  , const long long stepBudget
+  , const double timeBudget
+  , const long long memoryBudget
+  , const bool isSeedFixed
+  , const unsigned long long seed
+  , const bool areCyclesDetected
+  )
+{
+  MemorySink output;
+  // (what the front end displays is kept apart from the output of the program)
+  MemorySink checkOutput;
+  ofstream outputFile;
+  ofstream checkFile;
+  InputReader input;
+  ProgramExecutor executor(output);
+  int executionStatus;
+  chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+  // the input file is mapped into memory (a job without one has no input)
+  if (!job.inputFilename.empty() && !input.openFile(job.inputFilename)) {
+    job.status = BATCH_STATUS_NO_INPUT;
+  }
+  else {
+    // the front end shares its state, so one program is checked and loaded at a time
+    lock_guard<mutex> lock(s_frontEndMutex);
+    // captures what the front end displays
+    streambuf* cout_buffer = cout.rdbuf(&checkOutput);
+
+    if (!$SP::checkFileForm(job.programFilename)) {
+      job.status = BATCH_STATUS_BAD_FORM;
+    }
+    else {
+      $TG::generateFileTokens($SP::getFileData());
+      $TG::displayErrors();
+      $TG::displayWarnings();
+
+      if ($TG::getTokens().empty()) {
+        job.status = BATCH_STATUS_NOT_EXECUTABLE;
+      }
+      else {
+        executor.load($TG::getTokens());
+      }
+    }
+
+    cout.rdbuf(cout_buffer);
+  }
+
+  if (job.status == BATCH_STATUS_PENDING) {
+    executor.setBudgets(stepBudget, timeBudget, memoryBudget);
+    if (isSeedFixed) {
+      executor.setSeed(seed);
+    }
+    if (areCyclesDetected) {
+      executor.toggleCycleDetection();
+    }
+
+    executionStatus = executor.execute(input);
+    job.executionCount = executor.getExecutionCount();
+    job.memoryBytes = executor.getPeakMemory();
+    job.seed = executor.getSeed();
+
+    switch (executionStatus) {
+    case EXECUTION_STATUS_STEP_BUDGET:
+      job.status = BATCH_STATUS_STEP_BUDGET;
+      break;
+    case EXECUTION_STATUS_TIME_BUDGET:
+      job.status = BATCH_STATUS_TIME_BUDGET;
+      break;
+    case EXECUTION_STATUS_CANCELLED:
+      job.status = BATCH_STATUS_CANCELLED;
+      break;
+    case EXECUTION_STATUS_CYCLE:
+      job.status = BATCH_STATUS_CYCLE;
+      break;
+    case EXECUTION_STATUS_MEMORY_BUDGET:
+      job.status = BATCH_STATUS_MEMORY_BUDGET;
+      break;
+    default:
+      job.status = BATCH_STATUS_DONE;
+    }
+  }
+
+  job.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  checkFile.open(job.programFilename + BATCH_CHECK_SUFFIX);
+  if (checkFile.is_open()) {
+    checkFile << checkOutput.getData();
+  }
+
+  outputFile.open(job.programFilename + BATCH_OUTPUT_SUFFIX);
+  if (outputFile.is_open()) {
+    outputFile << output.getData();
+  }
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#ifndef BATCH_RUNNER_H
+#define BATCH_RUNNER_H
+
+#define $BR BatchRunner
+
+#include "ProgramExecutor.h"
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <mutex>
+#include <atomic>
+
+// suffix of the input file of a program in a batch directory
+#define BATCH_INPUT_SUFFIX ".in"
+// suffix of the file that the output of a program is written to
+#define BATCH_OUTPUT_SUFFIX ".out"
+// suffix of the file that what checking and tokenizing a program displayed is written to
+#define BATCH_CHECK_SUFFIX ".check"
+// suffix of the programs in a batch directory
+#define BATCH_PROGRAM_SUFFIX ".txt"
+
+// exit status of a program in a batch
+#define BATCH_STATUS_PENDING 0
+#define BATCH_STATUS_DONE 1
+#define BATCH_STATUS_BAD_FORM 2
+#define BATCH_STATUS_NOT_EXECUTABLE 3
+#define BATCH_STATUS_NO_INPUT 4
+// stopped before the program ended
+#define BATCH_STATUS_STEP_BUDGET 5
+#define BATCH_STATUS_TIME_BUDGET 6
+#define BATCH_STATUS_CANCELLED 7
+#define BATCH_STATUS_CYCLE 8
+#define BATCH_STATUS_MEMORY_BUDGET 9
+
+#define BATCH_THREAD_COUNT_DEFAULT 0
+
+std::string batchStatusToString(const int status);
+
+// a program of a batch and the results of running it
+struct BatchJob {
+  std::string programFilename;
+  // (empty if the program has no input)
+  std::string inputFilename;
+
+  int status;
+  double seconds;
+  long long executionCount;
+  // the most bytes the execution held
+  long long memoryBytes;
+  // the random seed the program was executed with
+  unsigned long long seed;
+
+  BatchJob(const std::string& i_programFilename = "", const std::string& i_inputFilename = "") {
+    programFilename = i_programFilename;
+    inputFilename = i_inputFilename;
+    status = BATCH_STATUS_PENDING;
+    seconds = 0.0;
+    executionCount = 0;
+    memoryBytes = 0;
+    seed = 0;
+  }
+};
+
+class BatchRunner {
+public:
+  // loads the jobs from a directory of programs (each with an optional input file of the same name)
+  //   or from a list file (with a program and an optional input file on each line)
+  static bool loadJobs(const std::string& path, std::vector<BatchJob>& jobs);
+
+  // checks, tokenizes and executes the jobs on threadCount threads
+  //   (or one per hardware thread if threadCount is not positive)
+  //   and writes the output of each program to its output file,
+  //   and what checking and tokenizing it displayed to its check file
+  //   (each program is stopped once it exhausts the step, time or memory budget, or once it repeats a state if cycles are detected,
+  //    and generates its random numbers from the seed if it is fixed, or from one of its own otherwise)
+  //   returns the wall time in seconds
+  static double run(
+    std::vector<BatchJob>& jobs
+    , const int threadCount = BATCH_THREAD_COUNT_DEFAULT
+    , const long long stepBudget = EXECUTION_BUDGET_NONE
+    , const double timeBudget = EXECUTION_BUDGET_NONE
+    , const long long memoryBudget = EXECUTION_BUDGET_NONE
+    , const bool isSeedFixed = false
+    , const unsigned long long seed = 0
+    , const bool areCyclesDetected = false
+    );
+
+  // displays the status, time and memory of each job and the wall time
+  static void displaySummary(const std::vector<BatchJob>& jobs, const double seconds, std::ostream& output = std::cout);
+
+private:
+  typedef BatchRunner __this;
+
+  // guards the syllable parser, token generator and word data, which are not reentrant
+  static std::mutex s_frontEndMutex;
+
+  // runs jobs until there are none left
+  static void runJobs(
+    std::vector<BatchJob>& jobs
+    , std::atomic<int>& nextJob
+    , const long long stepBudget
+    , const double timeBudget
+    , const long long memoryBudget
+    , const bool isSeedFixed
+    , const unsigned long long seed
+    , const bool areCyclesDetected
+    );
+
+  static void runJob(
+    BatchJob& job
+    , const long long stepBudget
+    , const double timeBudget
+    , const long long memoryBudget
+    , const bool isSeedFixed
+    , const unsigned long long seed
+    , const bool areCyclesDetected
+    );
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,296 @@
+#include "ExecutionCheckpoint.h"
+#include "ExecutionTrace.h"
+
+#include <cstring>
+
+using namespace std;
+
+//-------------------------------------------------------------------------------
+// ExecutionCheckpoint::write()
+//-------------------------------------------------------------------------------
+void ExecutionCheckpoint::write(ostream& output, const ProgramExecutor& executor, const InputPosition& inputPosition) {
+  unsigned long long randomState[RANDOM_STATE_SIZE];
+  map<const vector<Instruction>*, int> sequenceIds;
+  vector<const vector<Instruction>*> sequences;
+  map<const vector<Instruction>*, int>::iterator iter;
+  const Variable* variable;
+
+  output.write(EXECUTION_CHECKPOINT_MAGIC_STRING, sizeof(EXECUTION_CHECKPOINT_MAGIC_STRING) - 1);
+
+  // where the execution is
+  writeTraceInt(output, executor.m_bureaucrat);
+  writeTraceInt(output, executor.m_delegate);
+  writeTraceInt(output, executor.m_inputCounter);
+  writeTraceInt(output, executor.m_executionCounter);
+
+  executor.m_random.getState(randomState);
+  writeTraceInt(output, (long long)executor.m_seed);
+  for (int i = 0; i < RANDOM_STATE_SIZE; i++) {
+    writeTraceInt(output, (long long)randomState[i]);
+  }
+
+  writeTraceInt(output, inputPosition.offset);
+  writeTraceInt(output, inputPosition.isEof);
+  writeTraceInt(output, inputPosition.isFail);
+
+  // the program, as the header of a trace holds it
+  writeTraceInt(output, (long long)executor.m_rungs.size());
+  for (int i = 0; i < (int)executor.m_rungs.size(); i++) {
+    writeTraceRung(output, executor.m_rungs[i]);
+  }
+
+  writeTraceInt(output, (long long)executor.m_variableNames.size());
+  for (int i = 0; i < (int)executor.m_variableNames.size(); i++) {
+    writeTraceString(output, executor.m_variableNames[i]);
+  }
+
+  writeTraceInt(output, (long long)executor.m_program.size());
+  for (int i = 0; i < (int)executor.m_program.size(); i++) {
+    writeTraceInstruction(output, executor.m_program[i]);
+  }
+
+  // (the cached command sequences are rebuilt, so only their number is kept)
+  writeTraceInt(output, (long long)executor.m_commandSequences.size());
+
+  // the command sequences that variables store, each once
+  for (int i = 0; i < (int)executor.m_variables.size(); i++) {
+    variable = &executor.m_variables[i];
+    if (variable->isCommand && variable->commands && sequenceIds.find(variable->commands.get()) == sequenceIds.end()) {
+      sequenceIds[variable->commands.get()] = (int)sequences.size();
+      sequences.push_back(variable->commands.get());
+    }
+  }
+
+  writeTraceInt(output, (long long)sequences.size());
+  for (int i = 0; i < (int)sequences.size(); i++) {
+    writeTraceInt(output, (long long)sequences[i]->size());
+    for (int j = 0; j < (int)sequences[i]->size(); j++) {
+      writeTraceInstruction(output, (*sequences[i])[j]);
+    }
+  }
+
+  // the variables, by slot
+  for (int i = 0; i < (int)executor.m_variables.size(); i++) {
+    variable = &executor.m_variables[i];
+    iter = sequenceIds.find(variable->commands.get());
+
+    writeTraceInt(output, variable->isDefined);
+    writeTraceInt(output, variable->isCommand);
+    writeTraceValue(output, variable->value);
+    writeTraceInt(output, variable->element);
+    writeTraceInt(output, variable->isCommand && iter != sequenceIds.end() ? iter->second : TRACE_SEQUENCE_NONE);
+  }
+}
+
+//-------------------------------------------------------------------------------
+// ExecutionCheckpoint::read()
+//-------------------------------------------------------------------------------
+bool ExecutionCheckpoint::read(istream& input, ProgramExecutor& executor, InputPosition& inputPosition) {
+  executor.m_rungs.clear();
+  executor.m_sourceLines.clear();
+  executor.m_program.clear();
+  executor.m_variables.clear();
+  executor.m_variableNames.clear();
+  executor.m_variableSlots.clear();
+  executor.m_commandSequences.clear();
+  executor.m_builtCommandSequences.clear();
+
+  if (!readState(input, executor, inputPosition)) {
+    executor.m_program.clear();
+    executor.m_bureaucrat = 0;
+    executor.m_delegate = 0;
+    return false;
+  }
+
+  return true;
+}
+
+//-------------------------------------------------------------------------------
+// ExecutionCheckpoint::readState()
+//-------------------------------------------------------------------------------
+bool ExecutionCheckpoint::readState(istream& input, ProgramExecutor& executor, InputPosition& inputPosition) {
+  char magic[sizeof(EXECUTION_CHECKPOINT_MAGIC_STRING) - 1];
+  long long seed;
+  long long randomState_long;
+  unsigned long long randomState[RANDOM_STATE_SIZE];
+  int isEof;
+  int isFail;
+  int count;
+  int size;
+  Rung rung;
+  Instruction instruction;
+  string variableName;
+  vector<CommandSequence> sequences;
+  vector<Instruction> commands;
+  int isDefined;
+  int isCommand;
+  int element;
+  int sequenceId;
+
+  if (!input.read(magic, sizeof(magic))
+    || memcmp(magic, EXECUTION_CHECKPOINT_MAGIC_STRING, sizeof(magic)) != 0
+    )
+  {
+    return false;
+  }
+
+  if (!readTraceInt(input, executor.m_bureaucrat)
+    || !readTraceInt(input, executor.m_delegate)
+    || !readTraceInt(input, executor.m_inputCounter)
+    || !readTraceInt(input, executor.m_executionCounter)
+    || !readTraceInt(input, seed)
+    )
+  {
+    return false;
+  }
+  for (int i = 0; i < RANDOM_STATE_SIZE; i++) {
+    if (!readTraceInt(input, randomState_long)) {
+      return false;
+    }
+    randomState[i] = (unsigned long long)randomState_long;
+  }
+  executor.m_seed = (unsigned long long)seed;
+  executor.m_random.setState(randomState);
+
+  if (!readTraceInt(input, inputPosition.offset)
+    || !readTraceInt(input, isEof)
+    || !readTraceInt(input, isFail)
+    || inputPosition.offset < 0
+    )
+  {
+    return false;
+  }
+  inputPosition.isEof = isEof != 0;
+  inputPosition.isFail = isFail != 0;
+
+  // the rung table
+  if (!readTraceInt(input, count) || count < 0) {
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    if (!readTraceRung(input, rung)) {
+      return false;
+    }
+    executor.m_rungs.push_back(rung);
+  }
+
+  // the variable names, by slot
+  if (!readTraceInt(input, count) || count < 0) {
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    if (!readTraceString(input, variableName)) {
+      return false;
+    }
+    executor.m_variableNames.push_back(variableName);
+    executor.m_variableSlots[variableName] = i;
+  }
+
+  // the program
+  if (!readTraceInt(input, count) || count < 0) {
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    if (!readTraceInstruction(input, instruction)) {
+      return false;
+    }
+    executor.m_program.push_back(instruction);
+  }
+
+  if (!readTraceInt(input, count) || count < 0) {
+    return false;
+  }
+  executor.m_commandSequences.assign(count, CommandSequenceCache());
+
+  // the command sequences
+  if (!readTraceInt(input, count) || count < 0) {
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    if (!readTraceInt(input, size) || size < 0) {
+      return false;
+    }
+    commands.clear();
+    for (int j = 0; j < size; j++) {
+      if (!readTraceInstruction(input, instruction)) {
+        return false;
+      }
+      commands.push_back(instruction);
+    }
+    sequences.push_back(CommandSequence(new vector<Instruction>(commands)));
+  }
+
+  // the variables
+  executor.m_variables.assign(executor.m_variableNames.size(), Variable());
+  for (int i = 0; i < (int)executor.m_variables.size(); i++) {
+    Variable& variable = executor.m_variables[i];
+
+    if (!readTraceInt(input, isDefined)
+      || !readTraceInt(input, isCommand)
+      || !readTraceValue(input, variable.value)
+      || !readTraceInt(input, element)
+      || !readTraceInt(input, sequenceId)
+      || sequenceId < TRACE_SEQUENCE_NONE
+      || sequenceId >= (int)sequences.size()
+      )
+    {
+      return false;
+    }
+
+    variable.isDefined = isDefined != 0;
+    variable.isCommand = isCommand != 0;
+    variable.element = (char)element;
+    if (sequenceId != TRACE_SEQUENCE_NONE) {
+      variable.commands = sequences[sequenceId];
+    }
+  }
+
+  // the operands must refer to what was read, since they are not checked as the program executes
+  if (executor.m_bureaucrat < 0
+    || executor.m_bureaucrat > (int)executor.m_program.size()
+    || executor.m_delegate < 0
+    )
+  {
+    return false;
+  }
+  for (int i = 0; i < (int)executor.m_program.size(); i++) {
+    if (!isValidInstruction(executor.m_program[i], executor)) {
+      return false;
+    }
+  }
+  // (a variable executes the rungs of its sequence as the program executes its own)
+  for (int i = 0; i < (int)sequences.size(); i++) {
+    for (int j = 0; j < (int)sequences[i]->size(); j++) {
+      if (!isValidInstruction((*sequences[i])[j], executor)) {
+        return false;
+      }
+    }
+  }
+
+  executor.selectHandlers();
+
+  executor.m_isRandom = false;
+  for (int i = 0; i < (int)executor.m_program.size(); i++) {
+    if (executor.m_program[i].opcode == RESERVED_WORD_SOME || executor.m_program[i].opcode == RESERVED_WORD_MANY) {
+      executor.m_isRandom = true;
+    }
+  }
+
+  return true;
+}
+
+//-------------------------------------------------------------------------------
+// ExecutionCheckpoint::isValidInstruction()
+//-------------------------------------------------------------------------------
+bool ExecutionCheckpoint::isValidInstruction(const Instruction& instruction, const ProgramExecutor& executor) {
+  if ((instruction.opcode == OPCODE_VARIABLE && (instruction.operand < 0 || instruction.operand >= (int)executor.m_variables.size()))
+    || (instruction.opcode == OPCODE_PUNCTUATION && (instruction.operand < 0 || instruction.operand >= (int)executor.m_commandSequences.size()))
+    || instruction.rung < 0
+    || instruction.rung >= (int)executor.m_rungs.size()
+    )
+  {
+    return false;
+  }
+
+  return true;
+}
\ No newline at end of file
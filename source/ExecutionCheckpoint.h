@@ -0,0 +1,40 @@
+#ifndef EXECUTION_CHECKPOINT_H
+#define EXECUTION_CHECKPOINT_H
+
+#include "ProgramExecutor.h"
+#include "InputReader.h"
+
+#include <string>
+#include <iostream>
+
+#define EXECUTION_CHECKPOINT_FILE_STRING "__Haifu_checkpoint.bin"
+
+// identifies a checkpoint file and the version of its format
+#define EXECUTION_CHECKPOINT_MAGIC_STRING "HAIFUCP1"
+
+// a checkpoint is written to this file beside it, then renamed over it,
+// so that a checkpoint is never left half written
+#define CHECKPOINT_TEMPORARY_SUFFIX_STRING ".tmp"
+
+// the state of an execution between two rungs of the program, from which it can be resumed
+//   (written with the integers, doubles and records of the trace:
+//    the position and counters of the execution, the state of its generator, how far its input was read,
+//    the rung table, the variable names, the program, the command sequences and the variables)
+class ExecutionCheckpoint {
+public:
+  static void write(std::ostream& output, const ProgramExecutor& executor, const InputPosition& inputPosition);
+
+  // restores the executor to the checkpoint
+  //   returns false if the checkpoint is malformed, leaving the executor with no program
+  static bool read(std::istream& input, ProgramExecutor& executor, InputPosition& inputPosition);
+
+private:
+  typedef ExecutionCheckpoint __this;
+
+  static bool readState(std::istream& input, ProgramExecutor& executor, InputPosition& inputPosition);
+  // returns whether the operands of the instruction refer to what was read
+  //   (of the program or of a command sequence, since neither is checked as the program executes)
+  static bool isValidInstruction(const Instruction& instruction, const ProgramExecutor& executor);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include "ExecutionCycleDetector.h"
+
+#include <cstring>
+
+using namespace std;
+
+// spreads the bits of a number over its hash (the finalizer of splitmix64)
+static unsigned long long mix(unsigned long long value) {
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+  return value ^ (value >> 31);
+}
+
+// returns the bits of the value, which tell -0 and every NaN apart as well as integers from doubles
+static unsigned long long getValueBits(const RungValue& value) {
+  unsigned long long bits;
+  double real;
+
+  if (value.isInteger()) {
+    return (unsigned long long)value.getInteger();
+  }
+
+  real = value.toDouble();
+  memcpy(&bits, &real, sizeof(double));
+  return ~bits;
+}
+
+static bool isSameValue(const RungValue& value0, const RungValue& value1) {
+  return value0.isInteger() == value1.isInteger() && getValueBits(value0) == getValueBits(value1);
+}
+
+// returns the key of the instruction at the index
+//   (the handler is chosen from the program, so it is not part of the state)
+static unsigned long long hashInstruction(const Instruction& instruction, const int index) {
+  unsigned long long hash = mix((unsigned long long)index + 0x9E3779B97F4A7C15ULL);
+
+  hash = mix(hash ^ (unsigned char)instruction.opcode ^ ((unsigned long long)(unsigned char)instruction.element << 8));
+  hash = mix(hash ^ (unsigned int)instruction.operand ^ ((unsigned long long)(unsigned int)instruction.rung << 32));
+  hash = mix(hash ^ getValueBits(instruction.value) ^ instruction.value.isInteger());
+
+  return hash;
+}
+
+static bool isSameInstruction(const Instruction& instruction0, const Instruction& instruction1) {
+  return instruction0.opcode == instruction1.opcode
+    && instruction0.element == instruction1.element
+    && instruction0.operand == instruction1.operand
+    && instruction0.rung == instruction1.rung
+    && isSameValue(instruction0.value, instruction1.value)
+    ;
+}
+
+// returns the key of the variable in the slot
+//   (a command sequence is hashed by its rungs, since a sequence built again is equal to the one before it)
+static unsigned long long hashVariable(const Variable& variable, const int slot) {
+  unsigned long long hash = mix(~(unsigned long long)slot);
+
+  hash = mix(hash ^ variable.isDefined ^ (variable.isCommand << 1) ^ ((unsigned long long)(unsigned char)variable.element << 8));
+  hash = mix(hash ^ getValueBits(variable.value) ^ variable.value.isInteger());
+
+  if (variable.commands) {
+    for (int i = 0; i < (int)variable.commands->size(); i++) {
+      hash = mix(hash ^ hashInstruction((*variable.commands)[i], i));
+    }
+  }
+
+  return hash;
+}
+
+static bool isSameVariable(const Variable& variable0, const Variable& variable1) {
+  if (variable0.isDefined != variable1.isDefined
+    || variable0.isCommand != variable1.isCommand
+    || variable0.element != variable1.element
+    || !isSameValue(variable0.value, variable1.value)
+    || (bool)variable0.commands != (bool)variable1.commands
+    )
+  {
+    return false;
+  }
+
+  if (!variable0.commands || variable0.commands == variable1.commands) {
+    return true;
+  }
+
+  if (variable0.commands->size() != variable1.commands->size()) {
+    return false;
+  }
+  for (int i = 0; i < (int)variable0.commands->size(); i++) {
+    if (!isSameInstruction((*variable0.commands)[i], (*variable1.commands)[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+ExecutionCycleDetector::ExecutionCycleDetector() {
+  m_programHash = 0;
+  m_variablesHash = 0;
+  m_isProgramHashed = false;
+  m_cycleLength = 0;
+  restart();
+}
+
+void ExecutionCycleDetector::reset(const ProgramExecutor& executor) {
+  hashProgram(executor);
+
+  m_variableKeys.resize(executor.m_variables.size());
+  m_variablesHash = 0;
+  for (int i = 0; i < (int)executor.m_variables.size(); i++) {
+    m_variableKeys[i] = hashVariable(executor.m_variables[i], i);
+    m_variablesHash ^= m_variableKeys[i];
+  }
+
+  m_cycleLength = 0;
+  restart();
+}
+
+void ExecutionCycleDetector::restart() {
+  m_isSaved = false;
+  m_isVerifying = false;
+  m_power = 1;
+  m_length = 0;
+}
+
+void ExecutionCycleDetector::updateRung(const ProgramExecutor& executor, const int index) {
+  if (!m_isProgramHashed) {
+    return;
+  }
+
+  m_programHash ^= m_rungKeys[index];
+  m_rungKeys[index] = hashInstruction(executor.m_program[index], index);
+  m_programHash ^= m_rungKeys[index];
+}
+
+void ExecutionCycleDetector::updateVariable(const ProgramExecutor& executor, const int slot) {
+  m_variablesHash ^= m_variableKeys[slot];
+  m_variableKeys[slot] = hashVariable(executor.m_variables[slot], slot);
+  m_variablesHash ^= m_variableKeys[slot];
+}
+
+void ExecutionCycleDetector::invalidateProgram() {
+  m_isProgramHashed = false;
+}
+
+bool ExecutionCycleDetector::check(const ProgramExecutor& executor) {
+  unsigned long long hash;
+
+  if (!m_isProgramHashed) {
+    hashProgram(executor);
+  }
+  hash = hashState(executor);
+  m_length++;
+
+  if (m_isVerifying) {
+    if (m_length < m_verifiedLength) {
+      return false;
+    }
+    if (hash == m_savedHash && isSaved(executor)) {
+      m_cycleLength = executor.m_executionCounter - m_savedExecutionCounter;
+      return true;
+    }
+
+    // (two states had the same hash)
+    restart();
+  }
+  else if (m_isSaved && hash == m_savedHash) {
+    // the state is saved in full once its hash recurs, and must recur as many checks later
+    m_verifiedLength = m_length;
+    save(executor, hash);
+    m_isVerifying = true;
+    m_length = 0;
+    return false;
+  }
+
+  if (!m_isSaved || m_length >= m_power) {
+    m_isSaved = true;
+    m_savedHash = hash;
+    m_power *= 2;
+    m_length = 0;
+  }
+
+  return false;
+}
+
+long long ExecutionCycleDetector::getCycleLength() const {
+  return m_cycleLength;
+}
+
+void ExecutionCycleDetector::hashProgram(const ProgramExecutor& executor) {
+  m_rungKeys.resize(executor.m_program.size());
+  m_programHash = 0;
+  for (int i = 0; i < (int)executor.m_program.size(); i++) {
+    m_rungKeys[i] = hashInstruction(executor.m_program[i], i);
+    m_programHash ^= m_rungKeys[i];
+  }
+
+  m_isProgramHashed = true;
+}
+
+unsigned long long ExecutionCycleDetector::hashState(const ProgramExecutor& executor) const {
+  unsigned long long randomState[RANDOM_STATE_SIZE];
+  unsigned long long hash = m_programHash ^ m_variablesHash;
+
+  hash = mix(hash ^ (unsigned int)executor.m_bureaucrat ^ ((unsigned long long)(unsigned int)executor.m_delegate << 32));
+
+  executor.m_random.getState(randomState);
+  for (int i = 0; i < RANDOM_STATE_SIZE; i++) {
+    hash = mix(hash ^ randomState[i]);
+  }
+
+  return hash;
+}
+
+void ExecutionCycleDetector::save(const ProgramExecutor& executor, const unsigned long long hash) {
+  m_savedHash = hash;
+  m_savedProgram = executor.m_program;
+  m_savedVariables = executor.m_variables;
+  m_savedBureaucrat = executor.m_bureaucrat;
+  m_savedDelegate = executor.m_delegate;
+  executor.m_random.getState(m_savedRandomState);
+  m_savedExecutionCounter = executor.m_executionCounter;
+}
+
+bool ExecutionCycleDetector::isSaved(const ProgramExecutor& executor) const {
+  unsigned long long randomState[RANDOM_STATE_SIZE];
+
+  if (executor.m_bureaucrat != m_savedBureaucrat
+    || executor.m_delegate != m_savedDelegate
+    || executor.m_program.size() != m_savedProgram.size()
+    || executor.m_variables.size() != m_savedVariables.size()
+    )
+  {
+    return false;
+  }
+
+  executor.m_random.getState(randomState);
+  if (memcmp(randomState, m_savedRandomState, sizeof(randomState)) != 0) {
+    return false;
+  }
+
+  for (int i = 0; i < (int)m_savedProgram.size(); i++) {
+    if (!isSameInstruction(executor.m_program[i], m_savedProgram[i])) {
+      return false;
+    }
+  }
+  for (int i = 0; i < (int)m_savedVariables.size(); i++) {
+    if (!isSameVariable(executor.m_variables[i], m_savedVariables[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+#ifndef EXECUTION_CYCLE_DETECTOR_H
+#define EXECUTION_CYCLE_DETECTOR_H
+
+#include "ProgramExecutor.h"
+
+#include <vector>
+#include <deque>
+
+// finds when an execution returns to a state it was in without reading input or writing output in between,
+// after which it can only repeat itself
+//   (the state is the program, the variables, the bureaucrat, the delegate and the generator of some and many;
+//    its hash is the exclusive or of a key for each rung and each variable, updated as they change)
+//   the hash of the state is saved at doubling distances (Brent's method), so a cycle is found within
+//   about twice its length once the execution has entered it, and the state is only saved in full
+//   once its hash recurs, to be compared with the state a cycle later
+class ExecutionCycleDetector {
+public:
+  ExecutionCycleDetector();
+
+  // hashes the state of the executor, before an execution
+  void reset(const ProgramExecutor& executor);
+
+  // forgets the saved state, after the execution reads input or writes output
+  void restart();
+
+  // called after the rung at the index or the variable in the slot is changed
+  void updateRung(const ProgramExecutor& executor, const int index);
+  void updateVariable(const ProgramExecutor& executor, const int slot);
+  // called after a rung is inserted or removed, which moves every rung after it
+  //   (the program is hashed again at the next check)
+  void invalidateProgram();
+
+  // called between two rungs of the program
+  //   returns true if the state of the executor has recurred
+  bool check(const ProgramExecutor& executor);
+
+  // returns the executions from the saved state to its recurrence
+  long long getCycleLength() const;
+
+private:
+  typedef ExecutionCycleDetector __this;
+
+  // the keys of the rungs and of the variables, and the exclusive or of each
+  std::vector<unsigned long long> m_rungKeys;
+  std::vector<unsigned long long> m_variableKeys;
+  unsigned long long m_programHash;
+  unsigned long long m_variablesHash;
+  bool m_isProgramHashed;
+
+  // the hash of the saved state
+  bool m_isSaved;
+  unsigned long long m_savedHash;
+
+  // the state saved in full, while its recurrence is verified
+  bool m_isVerifying;
+  long long m_verifiedLength;
+  std::deque<Instruction> m_savedProgram;
+  std::vector<Variable> m_savedVariables;
+  int m_savedBureaucrat;
+  int m_savedDelegate;
+  unsigned long long m_savedRandomState[RANDOM_STATE_SIZE];
+  long long m_savedExecutionCounter;
+
+  // the checks from one saved hash to the next, and the checks since the last
+  long long m_power;
+  long long m_length;
+
+  long long m_cycleLength;
+
+  void hashProgram(const ProgramExecutor& executor);
+  unsigned long long hashState(const ProgramExecutor& executor) const;
+
+  void save(const ProgramExecutor& executor, const unsigned long long hash);
+  bool isSaved(const ProgramExecutor& executor) const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,353 @@
+#include "ExecutionProfiler.h"
+#include "funcs.h"
+
+#include <cmath>
+#include <algorithm>
+
+using namespace std;
+
+// a counter and what it counts (an opcode, a line number or a rung)
+typedef pair<ProfileCounter, int> ProfileEntry;
+
+// orders entries from the most time to the least, then from the most executions
+static bool isHotter(const ProfileEntry& entry0, const ProfileEntry& entry1) {
+  if (entry0.first.seconds != entry1.first.seconds) {
+    return entry0.first.seconds > entry1.first.seconds;
+  }
+
+  return entry0.first.executionCount > entry1.first.executionCount;
+}
+
+// returns the text with the characters that HTML reserves escaped
+static string escapeHTML(const string& text) {
+  string result;
+
+  for (int i = 0; i < (int)text.size(); i++) {
+    switch (text[i]) {
+    case '&':
+      result += "&amp;";
+      break;
+    case '<':
+      result += "&lt;";
+      break;
+    case '>':
+      result += "&gt;";
+      break;
+    case '"':
+      result += "&quot;";
+      break;
+    default:
+      result.push_back(text[i]);
+    }
+  }
+
+  return result;
+}
+
+// writes the executions and time of the counter, and its share of the total time
+static void writeCounter(ostream& output, const ProfileCounter& counter, const double totalSeconds) {
+  output << counter.executionCount << " executions";
+  if (counter.variableExecutionCount > 0) {
+    output << " (" << counter.variableExecutionCount << " in command variables)";
+  }
+  output << " " << counter.seconds << " seconds";
+  if (totalSeconds > 0.0) {
+    output << " " << counter.seconds / totalSeconds * 100.0 << "%";
+  }
+}
+
+ExecutionProfiler::ExecutionProfiler() {
+  reset();
+}
+
+void ExecutionProfiler::reset() {
+  m_start = chrono::steady_clock::now();
+  m_rungCounters.clear();
+  m_opcodeCounters.assign(OPCODE_COUNT, ProfileCounter());
+  m_frames.clear();
+}
+
+void ExecutionProfiler::enterRung() {
+  Frame frame;
+
+  frame.childSeconds = 0.0;
+  frame.start = chrono::steady_clock::now();
+  m_frames.push_back(frame);
+}
+
+void ExecutionProfiler::exitRung(const Instruction& instruction, const bool isInVariable) {
+  const double seconds = chrono::duration<double>(chrono::steady_clock::now() - m_frames.back().start).count();
+  const double selfSeconds = seconds - m_frames.back().childSeconds;
+  ProfileCounter* counter;
+
+  m_frames.pop_back();
+  if (!m_frames.empty()) {
+    m_frames.back().childSeconds += seconds;
+  }
+
+  // (input rungs are added to the rung table as the program executes)
+  if (instruction.rung >= (int)m_rungCounters.size()) {
+    m_rungCounters.resize(instruction.rung + 1);
+  }
+
+  for (int i = 0; i < 2; i++) {
+    counter = i == 0 ? &m_opcodeCounters[(int)instruction.opcode] : &m_rungCounters[instruction.rung];
+    counter->executionCount++;
+    if (isInVariable) {
+      counter->variableExecutionCount++;
+    }
+    counter->seconds += selfSeconds;
+  }
+}
+
+void ExecutionProfiler::writeReport(ostream& output, const vector<Rung>& rungs) const {
+  const double seconds = chrono::duration<double>(chrono::steady_clock::now() - m_start).count();
+  ProfileCounter total;
+  vector<ProfileEntry> opcodes;
+  map<int, ProfileCounter> lineCounters;
+  // the words of each line, by column
+  map<int, map<int, string> > lineWords;
+  vector<ProfileEntry> lines;
+  vector<ProfileEntry> rungsByTime;
+  string text;
+
+  for (int i = 0; i < (int)m_opcodeCounters.size(); i++) {
+    total.executionCount += m_opcodeCounters[i].executionCount;
+    total.variableExecutionCount += m_opcodeCounters[i].variableExecutionCount;
+    total.seconds += m_opcodeCounters[i].seconds;
+
+    if (m_opcodeCounters[i].executionCount > 0) {
+      opcodes.push_back(make_pair(m_opcodeCounters[i], i));
+    }
+  }
+
+  for (int i = 0; i < (int)rungs.size(); i++) {
+    if (rungs[i].lineNumber != INPUT_LINE_NUMBER) {
+      lineWords[rungs[i].lineNumber][rungs[i].columnNumber] = rungs[i].name;
+    }
+  }
+
+  for (int i = 0; i < (int)m_rungCounters.size() && i < (int)rungs.size(); i++) {
+    if (m_rungCounters[i].executionCount == 0) {
+      continue;
+    }
+
+    rungsByTime.push_back(make_pair(m_rungCounters[i], i));
+
+    ProfileCounter& lineCounter = lineCounters[rungs[i].lineNumber];
+    lineCounter.executionCount += m_rungCounters[i].executionCount;
+    lineCounter.variableExecutionCount += m_rungCounters[i].variableExecutionCount;
+    lineCounter.seconds += m_rungCounters[i].seconds;
+  }
+  for (map<int, ProfileCounter>::const_iterator it = lineCounters.begin(); it != lineCounters.end(); it++) {
+    lines.push_back(make_pair(it->second, it->first));
+  }
+
+  sort(opcodes.begin(), opcodes.end(), isHotter);
+  sort(lines.begin(), lines.end(), isHotter);
+  sort(rungsByTime.begin(), rungsByTime.end(), isHotter);
+
+  output << OUTPUT_LINE_STRING << endl;
+  output << "Profile of " << total.executionCount << " executions in " << seconds << " seconds" << endl;
+  output << "(" << total.seconds << " seconds in handlers, " << seconds - total.seconds << " seconds in profiling and dispatch)" << endl;
+
+  output << OUTPUT_LINE_STRING << endl;
+  output << "Commands:" << endl;
+  for (int i = 0; i < (int)opcodes.size(); i++) {
+    output << opcodeToString(opcodes[i].second) << " ";
+    writeCounter(output, opcodes[i].first, total.seconds);
+    output << " " << opcodes[i].first.seconds / opcodes[i].first.executionCount * 1.0e9 << " ns per execution" << endl;
+  }
+
+  output << OUTPUT_LINE_STRING << endl;
+  output << "Lines:" << endl;
+  for (int i = 0; i < (int)lines.size(); i++) {
+    if (lines[i].second == INPUT_LINE_NUMBER) {
+      output << "input ";
+      writeCounter(output, lines[i].first, total.seconds);
+      output << endl;
+      continue;
+    }
+
+    text.clear();
+    for (map<int, string>::const_iterator it = lineWords[lines[i].second].begin(); it != lineWords[lines[i].second].end(); it++) {
+      if (!text.empty()) {
+        text += " ";
+      }
+      text += it->second;
+    }
+
+    output << "line " << lines[i].second << " ";
+    writeCounter(output, lines[i].first, total.seconds);
+    output << " \"" << text << "\"" << endl;
+  }
+
+  output << OUTPUT_LINE_STRING << endl;
+  output << "Rungs:" << endl;
+  for (int i = 0; i < (int)rungsByTime.size() && i < PROFILE_RUNG_COUNT_MAX; i++) {
+    const Rung& rung = rungs[rungsByTime[i].second];
+
+    if (rung.lineNumber == INPUT_LINE_NUMBER) {
+      output << "input " << rung.columnNumber;
+    }
+    else {
+      output << "line " << rung.lineNumber << " column " << rung.columnNumber;
+    }
+    output << " \"" << rung.name << "\" " << rungTypeToString(rung.type) << " ";
+    writeCounter(output, rungsByTime[i].first, total.seconds);
+    output << endl;
+  }
+  output << OUTPUT_LINE_STRING << endl;
+}
+
+void ExecutionProfiler::writeHeatMap_TXT(ostream& output, const vector<Rung>& rungs, const vector<string>& sourceLines) const {
+  const long long executionCount = getExecutionCount();
+  map<int, map<int, long long> > wordCounts;
+  long long inputExecutionCount;
+  int numInputRungs;
+  int position;
+  int wordStart;
+  int wordSize;
+
+  getWordCounts(rungs, wordCounts, inputExecutionCount, numInputRungs);
+
+  output << "Heat map of " << executionCount << " executions" << endl;
+  output << "(each word that is a rung is followed by [executions share of all executions])" << endl;
+  output << OUTPUT_LINE_STRING << endl;
+
+  for (int i = 0; i < (int)sourceLines.size(); i++) {
+    const string& line = sourceLines[i];
+    const map<int, long long>& lineCounts = wordCounts[i];
+
+    position = 0;
+    for (map<int, long long>::const_iterator it = lineCounts.begin(); it != lineCounts.end(); it++) {
+      if (it->first < position || it->first >= (int)line.size()) {
+        continue;
+      }
+
+      getNextHaifuTokenWord(line, it->first, wordStart, wordSize);
+      output << line.substr(position, wordStart + wordSize - position);
+      output << "[" << it->second;
+      if (it->second > 0 && executionCount > 0) {
+        output << " " << (double)it->second / executionCount * 100.0 << "%";
+      }
+      output << "]";
+      position = wordStart + wordSize;
+    }
+    output << line.substr(min(position, (int)line.size())) << endl;
+  }
+
+  output << OUTPUT_LINE_STRING << endl;
+  output << "input " << numInputRungs << " rungs " << inputExecutionCount << " executions";
+  if (inputExecutionCount > 0 && executionCount > 0) {
+    output << " " << (double)inputExecutionCount / executionCount * 100.0 << "%";
+  }
+  output << endl;
+}
+
+void ExecutionProfiler::writeHeatMap_HTML(ostream& output, const vector<Rung>& rungs, const vector<string>& sourceLines) const {
+  const long long executionCount = getExecutionCount();
+  map<int, map<int, long long> > wordCounts;
+  long long inputExecutionCount;
+  int numInputRungs;
+  long long maxCount = 0;
+  int position;
+  int wordStart;
+  int wordSize;
+  int shade;
+
+  getWordCounts(rungs, wordCounts, inputExecutionCount, numInputRungs);
+
+  for (map<int, map<int, long long> >::const_iterator line = wordCounts.begin(); line != wordCounts.end(); line++) {
+    for (map<int, long long>::const_iterator it = line->second.begin(); it != line->second.end(); it++) {
+      maxCount = max(maxCount, it->second);
+    }
+  }
+
+  output << "<!DOCTYPE html>" << endl;
+  output << "<html><head><meta charset=\"utf-8\"><title>Haifu heat map</title>" << endl;
+  output << "<style>pre { font-size: 16px; line-height: 1.6; } span.cold { color: #8888aa; }</style>" << endl;
+  output << "</head><body>" << endl;
+  output << "<p>Heat map of " << executionCount << " executions (hover over a word for its executions)</p>" << endl;
+  output << "<pre>" << endl;
+
+  for (int i = 0; i < (int)sourceLines.size(); i++) {
+    const string& line = sourceLines[i];
+    const map<int, long long>& lineCounts = wordCounts[i];
+
+    position = 0;
+    for (map<int, long long>::const_iterator it = lineCounts.begin(); it != lineCounts.end(); it++) {
+      if (it->first < position || it->first >= (int)line.size()) {
+        continue;
+      }
+
+      getNextHaifuTokenWord(line, it->first, wordStart, wordSize);
+      output << escapeHTML(line.substr(position, wordStart - position));
+
+      if (it->second == 0) {
+        output << "<span class=\"cold\" title=\"0 executions\">";
+      }
+      else {
+        // the shade grows with the logarithm of the executions, so that the warm words are not all white
+        shade = 255 - (int)(200.0 * log(1.0 + it->second) / log(1.0 + maxCount));
+        output << "<span style=\"background-color: rgb(255, " << shade << ", " << shade << ")\""
+          << " title=\"" << it->second << " executions, " << (double)it->second / executionCount * 100.0 << "%\">";
+      }
+      output << escapeHTML(line.substr(wordStart, wordSize)) << "</span>";
+      position = wordStart + wordSize;
+    }
+    output << escapeHTML(line.substr(min(position, (int)line.size()))) << endl;
+  }
+
+  output << "</pre>" << endl;
+  output << "<p>Input: " << numInputRungs << " rungs, " << inputExecutionCount << " executions";
+  if (inputExecutionCount > 0 && executionCount > 0) {
+    output << ", " << (double)inputExecutionCount / executionCount * 100.0 << "%";
+  }
+  output << "</p>" << endl;
+  output << "</body></html>" << endl;
+}
+
+long long ExecutionProfiler::getExecutionCount() const {
+  long long executionCount = 0;
+
+  for (int i = 0; i < (int)m_opcodeCounters.size(); i++) {
+    executionCount += m_opcodeCounters[i].executionCount;
+  }
+
+  return executionCount;
+}
+
+void ExecutionProfiler::getWordCounts(
+  const vector<Rung>& rungs
+  , map<int, map<int, long long> >& wordCounts
+  , long long& inputExecutionCount
+  , int& numInputRungs
+  ) const
+{
+  long long executionCount;
+
+  inputExecutionCount = 0;
+  numInputRungs = 0;
+
+  for (int i = 0; i < (int)rungs.size(); i++) {
+    executionCount = i < (int)m_rungCounters.size() ? m_rungCounters[i].executionCount : 0;
+
+    if (rungs[i].lineNumber == INPUT_LINE_NUMBER) {
+      inputExecutionCount += executionCount;
+      numInputRungs++;
+    }
+    else {
+      // (a rung never executed is still shown, as a cold word)
+      wordCounts[rungs[i].lineNumber][rungs[i].columnNumber] += executionCount;
+    }
+  }
+}
+
+string ExecutionProfiler::opcodeToString(const int opcode) {
+  if (opcodeToRungType((char)opcode) == RUNG_TYPE_COMMAND) {
+    return rungCommandToString(opcode);
+  }
+
+  return rungTypeToString(opcodeToRungType((char)opcode));
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#ifndef EXECUTION_PROFILER_H
+#define EXECUTION_PROFILER_H
+
+#include "ProgramExecutor.h"
+
+#include <string>
+#include <vector>
+#include <map>
+#include <iostream>
+#include <chrono>
+
+#define EXECUTION_PROFILE_FILE_STRING "__Haifu_execution_profile.txt"
+#define EXECUTION_HEAT_MAP_FILE_STRING "__Haifu_heat_map.txt"
+#define EXECUTION_HEAT_MAP_HTML_FILE_STRING "__Haifu_heat_map.html"
+
+// the most rungs listed in the report
+#define PROFILE_RUNG_COUNT_MAX 20
+
+// the executions and time of a rung or of a kind of instruction
+//   (the time of a command variable excludes the rungs it executes, which are profiled on their own)
+struct ProfileCounter {
+  long long executionCount;
+  // executions from within a command variable
+  long long variableExecutionCount;
+  double seconds;
+
+  ProfileCounter() {
+    executionCount = 0;
+    variableExecutionCount = 0;
+    seconds = 0.0;
+  }
+};
+
+// counts the executions of each source rung and of each kind of instruction and times their handlers,
+// then reports where a program spent its time, by command, by line of the haiku and by rung
+class ExecutionProfiler {
+public:
+  ExecutionProfiler();
+
+  // clears the profile, before an execution
+  void reset();
+
+  // called before and after the handler of each rung is executed
+  //   (rungs executed by a command variable are entered while the variable is)
+  void enterRung();
+  void exitRung(const Instruction& instruction, const bool isInVariable);
+
+  // writes the report, with the rungs of the program and of its input in the rung table
+  void writeReport(std::ostream& output, const std::vector<Rung>& rungs) const;
+
+  // writes the source of the program with each of its rungs followed by its executions and its share of all executions
+  //   (the rungs that listen inserted are totalled after the source)
+  void writeHeatMap_TXT(std::ostream& output, const std::vector<Rung>& rungs, const std::vector<std::string>& sourceLines) const;
+  // writes the same as a page on which the words that executed more are redder
+  void writeHeatMap_HTML(std::ostream& output, const std::vector<Rung>& rungs, const std::vector<std::string>& sourceLines) const;
+
+private:
+  typedef ExecutionProfiler __this;
+
+  // a rung being executed
+  struct Frame {
+    std::chrono::steady_clock::time_point start;
+    // the time of the rungs executed by it
+    double childSeconds;
+  };
+
+  std::chrono::steady_clock::time_point m_start;
+
+  // indexed by the index of the rung in the rung table
+  std::vector<ProfileCounter> m_rungCounters;
+  // indexed by opcode
+  std::vector<ProfileCounter> m_opcodeCounters;
+
+  std::vector<Frame> m_frames;
+
+  // returns the executions of all the rungs
+  long long getExecutionCount() const;
+
+  // totals the executions of the rungs at each column of each line of the source,
+  // and those of the rungs that listen inserted
+  void getWordCounts(
+    const std::vector<Rung>& rungs
+    , std::map<int, std::map<int, long long> >& wordCounts
+    , long long& inputExecutionCount
+    , int& numInputRungs
+    ) const;
+
+  static std::string opcodeToString(const int opcode);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,375 @@
+#include "ExecutionTrace.h"
+
+#include <cstring>
+
+using namespace std;
+
+void writeTraceInt(ostream& output, const long long value) {
+  unsigned long long zigzag = ((unsigned long long)value << 1) ^ (unsigned long long)(value >> 63);
+
+  // seven bits at a time, with the high bit marking that more follow
+  while (zigzag >= 0x80) {
+    output.put((char)((zigzag & 0x7F) | 0x80));
+    zigzag >>= 7;
+  }
+  output.put((char)zigzag);
+}
+void writeTraceDouble(ostream& output, const double value) {
+  char bytes[sizeof(double)];
+
+  memcpy(bytes, &value, sizeof(double));
+  output.write(bytes, sizeof(double));
+}
+void writeTraceValue(ostream& output, const RungValue& value) {
+  writeTraceDouble(output, value.toDouble());
+}
+void writeTraceString(ostream& output, const string& value) {
+  writeTraceInt(output, (long long)value.size());
+  output.write(value.data(), value.size());
+}
+void writeTraceRung(ostream& output, const Rung& rung) {
+  writeTraceInt(output, rung.lineNumber);
+  writeTraceInt(output, rung.columnNumber);
+  writeTraceString(output, rung.name);
+  writeTraceInt(output, rung.type);
+  writeTraceDouble(output, rung.value);
+  writeTraceInt(output, rung.element);
+  writeTraceString(output, rung.variableName);
+}
+void writeTraceInstruction(ostream& output, const Instruction& instruction) {
+  writeTraceInt(output, instruction.opcode);
+  writeTraceInt(output, instruction.element);
+  writeTraceInt(output, instruction.operand);
+  writeTraceInt(output, instruction.rung);
+  writeTraceValue(output, instruction.value);
+}
+
+bool readTraceInt(istream& input, long long& value) {
+  unsigned long long zigzag = 0;
+  int shift = 0;
+  int byte;
+
+  do {
+    byte = input.get();
+    if (byte == EOF || shift > 63) {
+      return false;
+    }
+    zigzag |= (unsigned long long)(byte & 0x7F) << shift;
+    shift += 7;
+  } while (byte & 0x80);
+
+  value = (long long)(zigzag >> 1) ^ -(long long)(zigzag & 1);
+  return true;
+}
+bool readTraceInt(istream& input, int& value) {
+  long long value_long;
+
+  if (!readTraceInt(input, value_long)) {
+    return false;
+  }
+
+  value = (int)value_long;
+  return true;
+}
+bool readTraceDouble(istream& input, double& value) {
+  char bytes[sizeof(double)];
+
+  if (!input.read(bytes, sizeof(double))) {
+    return false;
+  }
+
+  memcpy(&value, bytes, sizeof(double));
+  return true;
+}
+bool readTraceValue(istream& input, RungValue& value) {
+  double value_double;
+
+  if (!readTraceDouble(input, value_double)) {
+    return false;
+  }
+
+  value = RungValue(value_double);
+  return true;
+}
+bool readTraceString(istream& input, string& value) {
+  long long size;
+
+  if (!readTraceInt(input, size) || size < 0) {
+    return false;
+  }
+
+  value.resize((size_t)size);
+  return size == 0 || (bool)input.read(&value[0], size);
+}
+bool readTraceRung(istream& input, Rung& rung) {
+  int type;
+  int element;
+
+  if (!readTraceInt(input, rung.lineNumber)
+    || !readTraceInt(input, rung.columnNumber)
+    || !readTraceString(input, rung.name)
+    || !readTraceInt(input, type)
+    || !readTraceDouble(input, rung.value)
+    || !readTraceInt(input, element)
+    || !readTraceString(input, rung.variableName)
+    )
+  {
+    return false;
+  }
+
+  rung.type = (char)type;
+  rung.element = (char)element;
+  return true;
+}
+bool readTraceInstruction(istream& input, Instruction& instruction) {
+  int opcode;
+  int element;
+
+  if (!readTraceInt(input, opcode)
+    || !readTraceInt(input, element)
+    || !readTraceInt(input, instruction.operand)
+    || !readTraceInt(input, instruction.rung)
+    || !readTraceValue(input, instruction.value)
+    )
+  {
+    return false;
+  }
+
+  instruction.opcode = (char)opcode;
+  instruction.handler = (char)opcode;
+  instruction.element = (char)element;
+  return true;
+}
+
+//-------------------------------------------------------------------------------
+// TraceReplayer::replay()
+//-------------------------------------------------------------------------------
+bool TraceReplayer::replay(
+  istream& trace
+  , ostream& output
+  , const int firstStep
+  , const int lastStep
+  , const bool areVariableExecutionsShown
+  )
+{
+  ProgramExecutor executor;
+  // the command sequences of the trace, by id
+  vector<CommandSequence> sequences;
+  bool isInRange = false;
+  long long tag;
+
+  long long step;
+  int index;
+  int slot;
+  int count;
+  int bureaucratMove;
+  int delegateMove;
+  int commandVariable;
+  int indexCommand;
+  int frameCount;
+  int sequenceId;
+  int isDefined;
+  int isCommand;
+  int element;
+  double variableValue;
+  Rung rung;
+  Instruction instruction;
+  vector<Instruction> commands;
+  string value;
+
+  if (!__this::readHeader(trace, executor)) {
+    return false;
+  }
+
+  while (readTraceInt(trace, tag)) {
+    switch (tag) {
+    case TRACE_RECORD_STEP:
+      if (!readTraceInt(trace, step)
+        || !readTraceInt(trace, commandVariable)
+        || !readTraceInt(trace, indexCommand)
+        || !readTraceInt(trace, frameCount)
+        || !readTraceInt(trace, bureaucratMove)
+        || !readTraceInt(trace, delegateMove)
+        )
+      {
+        return false;
+      }
+
+      // a step is executed by the frames of the step that entered its variable, and by its own
+      //   (only the slot of each frame is shown, so the frames hold no sequences)
+      if (frameCount < 0 || frameCount > (int)executor.m_commandFrames.size() + 1
+        || (frameCount > 0 && (commandVariable < 0 || commandVariable >= (int)executor.m_variableNames.size()))
+        )
+      {
+        return false;
+      }
+      executor.m_commandFrames.resize(frameCount, CommandFrame(commandVariable, CommandSequence()));
+      if (frameCount > 0) {
+        executor.m_commandFrames.back().slot = commandVariable;
+        executor.m_commandFrames.back().index = indexCommand;
+      }
+
+      executor.m_executionCounter = step;
+      executor.m_bureaucrat += bureaucratMove;
+      executor.m_delegate += delegateMove;
+
+      isInRange = step >= firstStep && (lastStep == TRACE_STEP_LAST || step <= lastStep);
+      if (isInRange && (indexCommand < 0 || areVariableExecutionsShown)) {
+        executor.outputExecution(output, commandVariable, indexCommand);
+      }
+      break;
+    case TRACE_RECORD_RUNG:
+      if (!readTraceRung(trace, rung)) {
+        return false;
+      }
+      executor.m_rungs.push_back(rung);
+      break;
+    case TRACE_RECORD_INSERT:
+      if (!readTraceInt(trace, index) || !readTraceInstruction(trace, instruction)
+        || index < 0 || index > (int)executor.m_program.size()
+        )
+      {
+        return false;
+      }
+      executor.m_program.insert(executor.m_program.begin() + index, instruction);
+      break;
+    case TRACE_RECORD_REMOVE:
+      if (!readTraceInt(trace, index) || index < 0 || index >= (int)executor.m_program.size()) {
+        return false;
+      }
+      executor.m_program.erase(executor.m_program.begin() + index);
+      break;
+    case TRACE_RECORD_SET:
+      if (!readTraceInt(trace, index) || !readTraceInstruction(trace, instruction)
+        || index < 0 || index >= (int)executor.m_program.size()
+        )
+      {
+        return false;
+      }
+      executor.m_program[index] = instruction;
+      break;
+    case TRACE_RECORD_SEQUENCE:
+      if (!readTraceInt(trace, count) || count < 0) {
+        return false;
+      }
+      commands.clear();
+      for (int i = 0; i < count; i++) {
+        if (!readTraceInstruction(trace, instruction)) {
+          return false;
+        }
+        commands.push_back(instruction);
+      }
+      sequences.push_back(make_shared<const vector<Instruction> >(commands));
+      break;
+    case TRACE_RECORD_VARIABLE:
+      if (!readTraceInt(trace, slot)
+        || !readTraceInt(trace, isDefined)
+        || !readTraceInt(trace, isCommand)
+        || !readTraceDouble(trace, variableValue)
+        || !readTraceInt(trace, element)
+        || !readTraceInt(trace, sequenceId)
+        || slot < 0 || slot >= (int)executor.m_variables.size()
+        || sequenceId < TRACE_SEQUENCE_NONE || sequenceId >= (int)sequences.size()
+        )
+      {
+        return false;
+      }
+      executor.m_variables[slot] = Variable(
+        isCommand != 0
+        , variableValue
+        , (char)element
+        , sequenceId == TRACE_SEQUENCE_NONE ? CommandSequence() : sequences[sequenceId]
+        , isDefined != 0
+        );
+      break;
+    case TRACE_RECORD_OUTPUT:
+      if (!readTraceString(trace, value)) {
+        return false;
+      }
+      if (isInRange) {
+        output << endl;
+        output << "Output: \"" << value << "\"" << endl;
+      }
+      break;
+    case TRACE_RECORD_END:
+      if (!readTraceInt(trace, step)
+        || !readTraceInt(trace, bureaucratMove)
+        || !readTraceInt(trace, delegateMove)
+        )
+      {
+        return false;
+      }
+
+      executor.m_executionCounter = step;
+      executor.m_bureaucrat += bureaucratMove;
+      executor.m_delegate += delegateMove;
+
+      if (lastStep == TRACE_STEP_LAST || lastStep >= step) {
+        executor.outputTermination(output);
+      }
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  // the trace ended before the execution did
+  return false;
+}
+
+//-------------------------------------------------------------------------------
+// TraceReplayer::readHeader()
+//-------------------------------------------------------------------------------
+bool TraceReplayer::readHeader(istream& trace, ProgramExecutor& executor) {
+  char magic[sizeof(EXECUTION_TRACE_MAGIC_STRING) - 1];
+  int count;
+  Rung rung;
+  Instruction instruction;
+  string variableName;
+
+  if (!trace.read(magic, sizeof(magic))
+    || memcmp(magic, EXECUTION_TRACE_MAGIC_STRING, sizeof(magic)) != 0
+    )
+  {
+    return false;
+  }
+
+  // the rung table
+  if (!readTraceInt(trace, count) || count < 0) {
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    if (!readTraceRung(trace, rung)) {
+      return false;
+    }
+    executor.m_rungs.push_back(rung);
+  }
+
+  // the variable names, by slot
+  if (!readTraceInt(trace, count) || count < 0) {
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    if (!readTraceString(trace, variableName)) {
+      return false;
+    }
+    executor.m_variableNames.push_back(variableName);
+    executor.m_variableSlots[variableName] = i;
+  }
+  executor.m_variables.assign(executor.m_variableNames.size(), Variable());
+
+  // the program
+  if (!readTraceInt(trace, count) || count < 0) {
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    if (!readTraceInstruction(trace, instruction)) {
+      return false;
+    }
+    executor.m_program.push_back(instruction);
+  }
+
+  executor.m_bureaucrat = 0;
+  executor.m_delegate = 0;
+  return true;
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#ifndef EXECUTION_TRACE_H
+#define EXECUTION_TRACE_H
+
+#include "ProgramExecutor.h"
+
+#include <string>
+#include <iostream>
+
+#define EXECUTION_TRACE_FILE_STRING "__Haifu_execution_trace.bin"
+
+// identifies a trace file and the version of its format
+#define EXECUTION_TRACE_MAGIC_STRING "HAIFUTR2"
+
+// tags of the records in a trace
+//   (the header holds the rung table, the variable names and the program)
+#define TRACE_RECORD_STEP 1
+#define TRACE_RECORD_RUNG 2
+#define TRACE_RECORD_INSERT 3
+#define TRACE_RECORD_REMOVE 4
+#define TRACE_RECORD_SET 5
+#define TRACE_RECORD_VARIABLE 6
+#define TRACE_RECORD_SEQUENCE 7
+#define TRACE_RECORD_OUTPUT 8
+#define TRACE_RECORD_END 9
+
+// the sequence id of a variable that is not a command variable
+#define TRACE_SEQUENCE_NONE -1
+
+// the last step to replay when the rest of the trace is replayed
+#define TRACE_STEP_LAST -1
+
+// integers are written as zigzag variable-length quantities
+void writeTraceInt(std::ostream& output, const long long value);
+void writeTraceDouble(std::ostream& output, const double value);
+// (a value is written as its double)
+void writeTraceValue(std::ostream& output, const RungValue& value);
+void writeTraceString(std::ostream& output, const std::string& value);
+void writeTraceRung(std::ostream& output, const Rung& rung);
+void writeTraceInstruction(std::ostream& output, const Instruction& instruction);
+
+// return false at the end of the trace
+bool readTraceInt(std::istream& input, long long& value);
+bool readTraceInt(std::istream& input, int& value);
+bool readTraceDouble(std::istream& input, double& value);
+bool readTraceValue(std::istream& input, RungValue& value);
+bool readTraceString(std::istream& input, std::string& value);
+bool readTraceRung(std::istream& input, Rung& rung);
+bool readTraceInstruction(std::istream& input, Instruction& instruction);
+
+// rebuilds the execution log from a trace
+class TraceReplayer {
+public:
+  // replays the trace and writes the execution log of the steps from firstStep to lastStep
+  //   (including the executions of command variables if areVariableExecutionsShown)
+  //   returns false if the trace is malformed
+  static bool replay(
+    std::istream& trace
+    , std::ostream& output
+    , const int firstStep = 0
+    , const int lastStep = TRACE_STEP_LAST
+    , const bool areVariableExecutionsShown = true
+    );
+
+private:
+  typedef TraceReplayer __this;
+
+  static bool readHeader(std::istream& trace, ProgramExecutor& executor);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,481 @@
+#include "InputReader.h"
+
+#include <cmath>
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+// files are mapped into memory where the system supports it
+#if defined(__unix__) || defined(__APPLE__)
+#define USE_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+using namespace std;
+
+// returns whether >> skips the byte as whitespace
+static bool isSpaceByte(const int c) {
+  return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+static bool isDigitByte(const int c) {
+  return c >= '0' && c <= '9';
+}
+
+// returns the number of bytes read, or 0 at the end of the file
+//   (a read returns what a pipe has so far, rather than waiting for the buffer to fill)
+static int readFileDescriptor(const int fileDescriptor, char* buffer, const int size) {
+  int numRead;
+
+#if defined(USE_MMAP)
+  numRead = (int)read(fileDescriptor, buffer, (size_t)size);
+#elif defined(_WIN32)
+  numRead = _read(fileDescriptor, buffer, (unsigned int)size);
+#else
+  // only standard input is read a buffer at a time here
+  numRead = (int)fread(buffer, 1, (size_t)size, stdin);
+#endif
+
+  return numRead > 0 ? numRead : 0;
+}
+
+// returns whether the file is a terminal
+static bool isTerminal(const int fileDescriptor) {
+#if defined(USE_MMAP)
+  return isatty(fileDescriptor) != 0;
+#elif defined(_WIN32)
+  return _isatty(fileDescriptor) != 0;
+#else
+  // (where it cannot be told, standard input is taken to be typed)
+  return fileDescriptor == 0;
+#endif
+}
+
+InputReader::InputReader() {
+  initialize();
+}
+
+InputReader::InputReader(istream& input, const int mode) {
+  initialize();
+
+  m_mode = mode;
+  m_stream = &input;
+  m_streamBuffer = input.rdbuf();
+  m_isInteractive = m_streamBuffer == cin.rdbuf() && isTerminal(0);
+  m_isEof = input.eof();
+  m_isFail = input.fail();
+}
+
+InputReader::InputReader(const char* data, const size_t size, const int mode) {
+  initialize();
+
+  m_mode = mode;
+  m_next = data;
+  m_end = data + size;
+}
+
+InputReader::~InputReader() {
+  close();
+}
+
+void InputReader::initialize() {
+  m_stream = NULL;
+  m_streamBuffer = NULL;
+  m_next = NULL;
+  m_end = NULL;
+  m_mode = INPUT_MODE_LINE;
+  m_isInteractive = false;
+  m_fileDescriptor = -1;
+  m_isFileDescriptorOwned = false;
+  m_buffer = NULL;
+  m_mapping = NULL;
+  m_mappingSize = 0;
+  m_isEof = false;
+  m_isFail = false;
+  m_offset = 0;
+}
+
+bool InputReader::openFile(const string& filename) {
+  close();
+
+#if defined(USE_MMAP) || defined(_WIN32)
+  int file;
+
+#ifdef USE_MMAP
+  struct stat fileStat;
+
+  file = open(filename.c_str(), O_RDONLY);
+#else
+  file = _open(filename.c_str(), _O_RDONLY | _O_BINARY);
+#endif
+  if (file < 0) {
+    return false;
+  }
+
+#ifdef USE_MMAP
+  // only a regular file with something in it can be mapped
+  if (fstat(file, &fileStat) == 0 && S_ISREG(fileStat.st_mode) && fileStat.st_size > 0) {
+    m_mapping = mmap(NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    if (m_mapping == MAP_FAILED) {
+      m_mapping = NULL;
+    }
+    else {
+      m_mappingSize = (size_t)fileStat.st_size;
+      m_next = (const char*)m_mapping;
+      m_end = m_next + m_mappingSize;
+      // the input is read from start to end
+      madvise(m_mapping, m_mappingSize, MADV_SEQUENTIAL);
+    }
+  }
+
+  if (m_mapping != NULL) {
+    ::close(file);
+    m_mode = INPUT_MODE_STREAM;
+    return true;
+  }
+#endif
+
+  openFileDescriptor(file, true);
+
+  return true;
+#else
+  // read whole where the file cannot be read a buffer at a time
+  ifstream file_stream(filename, ios::in | ios::binary);
+  stringstream file_data;
+
+  if (!file_stream.is_open()) {
+    return false;
+  }
+
+  file_data << file_stream.rdbuf();
+  m_fileData = file_data.str();
+  m_next = m_fileData.data();
+  m_end = m_next + m_fileData.size();
+  m_mode = INPUT_MODE_STREAM;
+
+  return true;
+#endif
+}
+
+void InputReader::openStandardInput() {
+  close();
+
+  openFileDescriptor(0, false);
+}
+
+void InputReader::openFileDescriptor(const int fileDescriptor, const bool isOwned) {
+  m_mode = INPUT_MODE_STREAM;
+  m_isInteractive = isTerminal(fileDescriptor);
+  m_fileDescriptor = fileDescriptor;
+  m_isFileDescriptorOwned = isOwned;
+  m_buffer = new char[INPUT_BUFFER_SIZE + 1];
+  m_next = m_buffer + 1;
+  m_end = m_buffer + 1;
+}
+
+void InputReader::close() {
+  // the stream is left as it would have been had it been parsed directly
+  if (m_stream != NULL) {
+    m_stream->clear((m_isEof ? ios::eofbit : ios::goodbit) | (m_isFail ? ios::failbit : ios::goodbit));
+  }
+
+#ifdef USE_MMAP
+  if (m_mapping != NULL) {
+    munmap(m_mapping, m_mappingSize);
+  }
+  if (m_isFileDescriptorOwned) {
+    ::close(m_fileDescriptor);
+  }
+#elif defined(_WIN32)
+  if (m_isFileDescriptorOwned) {
+    _close(m_fileDescriptor);
+  }
+#endif
+
+  delete[] m_buffer;
+  m_fileData.clear();
+
+  initialize();
+}
+
+bool InputReader::isInteractive() const {
+  return m_isInteractive;
+}
+
+bool InputReader::isEndOfInput() {
+  int next;
+
+  if (m_isEof) {
+    return true;
+  }
+
+  // peek, ignoring spaces
+  if (!good()) {
+    m_isFail = true;
+    return false;
+  }
+  next = peekByte();
+  while (next == ' ' || (m_mode == INPUT_MODE_STREAM && isSpaceByte(next))) {
+    skipByte();
+    next = peekByte();
+  }
+  if (next == EOF) {
+    m_isEof = true;
+
+    // a stream of input has simply run out
+    return m_mode == INPUT_MODE_STREAM;
+  }
+
+  return next == '\n' && m_mode == INPUT_MODE_LINE;
+}
+
+void InputReader::readValue(string& text, double& value) {
+  char input_char = '\0';
+  int input_int_whole = 0;
+  int input_int_fractional = 0;
+  int input_int_fractional_size = 0;
+  bool isNumber = false;
+  int numDigits;
+  int next;
+
+  // the first character, which is left in the input
+  if (good()) {
+    next = peekByte();
+    while (isSpaceByte(next)) {
+      skipByte();
+      next = peekByte();
+    }
+
+    if (next == EOF) {
+      m_isEof = true;
+      m_isFail = true;
+    }
+    else {
+      input_char = (char)next;
+    }
+  }
+  else {
+    m_isFail = true;
+  }
+  // (putting it back clears the end of the input)
+  m_isEof = false;
+
+  // see if the first part of the input is formatted like an int
+  if (good()) {
+    isNumber = readInt(input_int_whole, numDigits, true);
+  }
+  else {
+    m_isFail = true;
+  }
+
+  if (!isNumber) {
+    m_isEof = false;
+    m_isFail = false;
+
+    // skip the character, unless it was a sign that the int already took
+    if (input_char != '+' && input_char != '-') {
+      if (peekByte() == EOF) {
+        m_isEof = true;
+        m_isFail = true;
+      }
+      else {
+        skipByte();
+      }
+    }
+
+    text.assign(1, input_char);
+    value = input_char;
+    return;
+  }
+
+  // the fractional part follows a '.' that is followed by a numeral
+  if (m_isEof) {
+    m_isEof = false;
+    m_isFail = true;
+  }
+  else {
+    next = peekByte();
+    if (next == EOF) {
+      m_isFail = true;
+    }
+    else if (next == '.') {
+      skipByte();
+      if (isDigitByte(peekByte())) {
+        readInt(input_int_fractional, input_int_fractional_size, false);
+      }
+      else {
+        unskipByte();
+      }
+    }
+  }
+
+  text = to_string(input_int_whole);
+  value = input_int_whole;
+
+  if (input_int_fractional != 0) {
+    text.push_back('.');
+    text += to_string(input_int_fractional);
+
+    // divide fractional part by 10^(its size) and combine it with the whole part
+    if (value >= 0.0) {
+      value += input_int_fractional / pow(10.0, input_int_fractional_size);
+    }
+    else {
+      value -= input_int_fractional / pow(10.0, input_int_fractional_size);
+    }
+  }
+}
+
+InputPosition InputReader::getPosition() const {
+  InputPosition position;
+
+  position.offset = m_offset;
+  position.isEof = m_isEof;
+  position.isFail = m_isFail;
+
+  return position;
+}
+
+bool InputReader::restorePosition(const InputPosition& position) {
+  long long numSkipped;
+
+  while (m_offset < position.offset) {
+    // what is in memory is passed over at once
+    if (m_next < m_end) {
+      numSkipped = min((long long)(m_end - m_next), position.offset - m_offset);
+      m_next += numSkipped;
+      m_offset += numSkipped;
+    }
+    else if (peekByte() == EOF) {
+      return false;
+    }
+    else {
+      skipByte();
+    }
+  }
+
+  m_isEof = position.isEof;
+  m_isFail = position.isFail;
+
+  return m_offset == position.offset;
+}
+
+bool InputReader::good() const {
+  return !m_isEof && !m_isFail;
+}
+
+int InputReader::peekByte() {
+  int next;
+
+  if (m_next < m_end) {
+    return (unsigned char)*m_next;
+  }
+
+  if (m_streamBuffer != NULL) {
+    next = m_streamBuffer->sgetc();
+    return next == char_traits<char>::eof() ? EOF : (unsigned char)next;
+  }
+
+  if (fill()) {
+    return (unsigned char)*m_next;
+  }
+
+  return EOF;
+}
+
+void InputReader::skipByte() {
+  if (m_next < m_end) {
+    m_next++;
+  }
+  else if (m_streamBuffer != NULL) {
+    m_streamBuffer->sbumpc();
+  }
+  m_offset++;
+}
+
+void InputReader::unskipByte() {
+  if (m_streamBuffer != NULL) {
+    m_streamBuffer->sungetc();
+  }
+  else {
+    m_next--;
+  }
+  m_offset--;
+}
+
+bool InputReader::fill() {
+  int numRead;
+
+  if (m_fileDescriptor < 0) {
+    return false;
+  }
+
+  // the last byte stays in front of the buffer
+  if (m_end > m_buffer + 1) {
+    m_buffer[0] = m_end[-1];
+  }
+
+  numRead = readFileDescriptor(m_fileDescriptor, m_buffer + 1, INPUT_BUFFER_SIZE);
+  m_next = m_buffer + 1;
+  m_end = m_next + numRead;
+
+  return numRead > 0;
+}
+
+bool InputReader::readInt(int& value, int& numDigits, const bool isSigned) {
+  bool isNegative = false;
+  unsigned long long limit = INT_MAX;
+  unsigned long long result = 0;
+  bool isOverflow = false;
+  int next;
+
+  numDigits = 0;
+
+  next = peekByte();
+  if (isSigned && (next == '-' || next == '+')) {
+    isNegative = next == '-';
+    skipByte();
+    next = peekByte();
+  }
+  if (isNegative) {
+    limit = (unsigned long long)INT_MAX + 1;
+  }
+
+  while (isDigitByte(next)) {
+    result = result * 10 + (next - '0');
+    if (result > limit) {
+      isOverflow = true;
+      result = limit;
+    }
+    numDigits++;
+
+    skipByte();
+    next = peekByte();
+  }
+
+  if (next == EOF) {
+    m_isEof = true;
+  }
+
+  if (numDigits == 0) {
+    value = 0;
+    m_isFail = true;
+    return false;
+  }
+  if (isOverflow) {
+    value = isNegative ? INT_MIN : INT_MAX;
+    m_isFail = true;
+    return false;
+  }
+
+  value = isNegative ? (int)-(long long)result : (int)result;
+  return true;
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#ifndef INPUT_READER_H
+#define INPUT_READER_H
+
+#include <string>
+#include <iostream>
+#include <streambuf>
+
+// where the input of a program ends
+//   (a line of input is what is typed after a command, so it ends with the line,
+//    while a stream of input ends only with its data, its lines being separated like any other values)
+#define INPUT_MODE_LINE 0
+#define INPUT_MODE_STREAM 1
+
+// bytes read from standard input, a pipe or a file that is not mapped at a time
+#define INPUT_BUFFER_SIZE (1 << 16)
+
+// how far a reader has read, so that the input can be read again from there
+struct InputPosition {
+  // bytes parsed
+  long long offset;
+  // the state flags of the reader
+  bool isEof;
+  bool isFail;
+
+  InputPosition() {
+    offset = 0;
+    isEof = false;
+    isFail = false;
+  }
+};
+
+// scans the input of a program straight out of a byte buffer
+//   the input can be read through a stream, from standard input, from a pipe,
+//   or from a file mapped into memory, and only a buffer of it is held at a time
+//   (the reader keeps the state flags that a stream would, so that listen behaves
+//    exactly as it did when it parsed the stream with >>, get, peek and putback)
+class InputReader {
+public:
+  // no input
+  InputReader();
+  // reads through the buffer of the stream, never past what has been parsed
+  //   (the stream is given the state of the reader when the reader is destroyed)
+  InputReader(std::istream& input, const int mode = INPUT_MODE_LINE);
+  // reads a region of memory, which must outlive the reader
+  InputReader(const char* data, const size_t size, const int mode = INPUT_MODE_STREAM);
+  ~InputReader();
+
+  // maps the file into memory, or reads it a buffer at a time if it cannot be mapped (as a named pipe cannot)
+  //   the file is read as a stream of input
+  //   returns false if the file cannot be opened
+  bool openFile(const std::string& filename);
+
+  // reads standard input a buffer at a time as a stream of input
+  void openStandardInput();
+
+  void close();
+
+  // returns whether the input may be typed as it is read (standard input that is a terminal),
+  // so that what the program has written should be shown first
+  bool isInteractive() const;
+
+  // returns true at the end of the input
+  //   (or of its current line for a line of input, as endOfStream does)
+  bool isEndOfInput();
+
+  // reads the next value as listen does
+  //   text is the name of the input rung and value is its value
+  //   (a number, or the code of a single character)
+  void readValue(std::string& text, double& value);
+
+  InputPosition getPosition() const;
+  // reads ahead to the position, which must not be behind the reader
+  //   returns false if the input ends before it
+  bool restorePosition(const InputPosition& position);
+
+private:
+  typedef InputReader __this;
+
+  // the stream read through, if any
+  std::istream* m_stream;
+  std::streambuf* m_streamBuffer;
+
+  // the bytes that are in memory
+  const char* m_next;
+  const char* m_end;
+
+  int m_mode;
+  bool m_isInteractive;
+
+  // the file read into the buffer, or -1 (the byte before the buffer is kept for unskipByte)
+  int m_fileDescriptor;
+  bool m_isFileDescriptorOwned;
+  char* m_buffer;
+
+  // the file mapped into memory, or read into a buffer
+  void* m_mapping;
+  size_t m_mappingSize;
+  std::string m_fileData;
+
+  // the state flags of a stream
+  bool m_isEof;
+  bool m_isFail;
+
+  // bytes parsed
+  long long m_offset;
+
+  void initialize();
+
+  // reads the file a buffer at a time
+  void openFileDescriptor(const int fileDescriptor, const bool isOwned);
+
+  bool good() const;
+
+  // returns the next byte, or EOF at the end of the input
+  int peekByte();
+  void skipByte();
+  // moves back over the last byte skipped
+  void unskipByte();
+  // reads more of the input into the buffer
+  //   returns false at the end of the input
+  bool fill();
+
+  // emulates >> for an int (with a sign if isSigned), returning false if the stream fails
+  //   numDigits is the number of numerals read
+  bool readInt(int& value, int& numDigits, const bool isSigned);
+};
+
+#endif
\ No newline at end of file
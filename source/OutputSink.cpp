@@ -0,0 +1,129 @@
+#include "OutputSink.h"
+
+#include <charconv>
+#include <cstring>
+
+using namespace std;
+
+int formatNumber(const double value, char* buffer) {
+  to_chars_result result = to_chars(buffer, buffer + NUMBER_STRING_LENGTH_MAX, value, chars_format::general, 6);
+
+  return (int)(result.ptr - buffer);
+}
+
+OutputSink::OutputSink(const int flushPolicy, const size_t flushSize) {
+  m_flushPolicy = flushPolicy;
+  m_flushSize = flushSize;
+  m_buffer.reserve(flushSize);
+}
+
+OutputSink::~OutputSink() {
+}
+
+void OutputSink::write(const char c) {
+  m_buffer.push_back(c);
+  afterWrite(c == '\n');
+}
+
+void OutputSink::write(const char* s, const size_t n) {
+  m_buffer.append(s, n);
+  afterWrite(m_flushPolicy == SINK_FLUSH_ON_NEWLINE && memchr(s, '\n', n) != NULL);
+}
+
+void OutputSink::writeNumber(const double value) {
+  char buffer[NUMBER_STRING_LENGTH_MAX];
+
+  write(buffer, formatNumber(value, buffer));
+}
+
+void OutputSink::flush() {
+  if (!m_buffer.empty()) {
+    writeOut(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+  }
+}
+
+int OutputSink::overflow(int c) {
+  if (c != EOF) {
+    write((char)c);
+  }
+
+  return c == EOF ? 0 : c;
+}
+
+streamsize OutputSink::xsputn(const char* s, streamsize n) {
+  write(s, (size_t)n);
+
+  return n;
+}
+
+int OutputSink::sync() {
+  return 0;
+}
+
+void OutputSink::afterWrite(const bool hasNewline) {
+  switch (m_flushPolicy) {
+  case SINK_FLUSH_ON_NEWLINE:
+    if (hasNewline) {
+      flush();
+    }
+    break;
+  case SINK_FLUSH_ON_SIZE:
+    if (m_buffer.size() >= m_flushSize) {
+      flush();
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+StreamSink::StreamSink(ostream& output, const int flushPolicy, const size_t flushSize)
+  : OutputSink(flushPolicy, flushSize)
+  , m_stream(output)
+{
+}
+
+StreamSink::~StreamSink() {
+  flush();
+}
+
+void StreamSink::writeOut(const char* s, const size_t n) {
+  m_stream.write(s, (streamsize)n);
+  m_stream.flush();
+}
+
+FileSink::FileSink(const string& filename, const int flushPolicy, const size_t flushSize)
+  : OutputSink(flushPolicy, flushSize)
+{
+  m_file.open(filename);
+}
+
+FileSink::~FileSink() {
+  flush();
+}
+
+bool FileSink::is_open() const {
+  return m_file.is_open();
+}
+
+void FileSink::writeOut(const char* s, const size_t n) {
+  m_file.write(s, (streamsize)n);
+  m_file.flush();
+}
+
+MemorySink::MemorySink() {
+}
+
+MemorySink::~MemorySink() {
+}
+
+const string& MemorySink::getData() {
+  flush();
+
+  return m_data;
+}
+
+void MemorySink::writeOut(const char* s, const size_t n) {
+  m_data.append(s, n);
+}
\ No newline at end of file
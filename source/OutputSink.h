@@ -0,0 +1,105 @@
+#ifndef OUTPUT_SINK_H
+#define OUTPUT_SINK_H
+
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+
+// when a sink writes out what it has buffered
+//   (every sink also writes out when it is flushed or destroyed,
+//    so a sink that flushes on exit holds everything until then)
+#define SINK_FLUSH_ON_EXIT 0
+#define SINK_FLUSH_ON_NEWLINE 1
+#define SINK_FLUSH_ON_SIZE 2
+
+// bytes buffered before a sink that flushes on size writes them out
+#define SINK_BUFFER_SIZE (1 << 16)
+
+// long enough for any double in the general format
+#define NUMBER_STRING_LENGTH_MAX 32
+
+// writes the value as an output stream would by default (the general format with 6 significant digits)
+//   returns the number of characters written
+int formatNumber(const double value, char* buffer);
+
+// buffers the output of a program and writes it out according to its flush policy
+//   (a sink is also a stream buffer, so that messages can be written to it with <<)
+class OutputSink : public std::streambuf {
+public:
+  OutputSink(const int flushPolicy = SINK_FLUSH_ON_SIZE, const size_t flushSize = SINK_BUFFER_SIZE);
+  virtual ~OutputSink();
+
+  void write(const char c);
+  void write(const char* s, const size_t n);
+  // writes the number without allocating
+  void writeNumber(const double value);
+
+  // writes out everything buffered
+  void flush();
+
+protected:
+  // writes buffered characters to where the sink leads
+  virtual void writeOut(const char* s, const size_t n) = 0;
+
+  int overflow(int c);
+  std::streamsize xsputn(const char* s, std::streamsize n);
+  // flushing the stream is left to the flush policy
+  int sync();
+
+private:
+  typedef OutputSink __this;
+
+  int m_flushPolicy;
+  size_t m_flushSize;
+  std::string m_buffer;
+
+  // writes out the buffer if the policy calls for it after the characters were added
+  void afterWrite(const bool hasNewline);
+};
+
+// writes to an output stream (standard output by default)
+class StreamSink : public OutputSink {
+public:
+  StreamSink(std::ostream& output = std::cout, const int flushPolicy = SINK_FLUSH_ON_SIZE, const size_t flushSize = SINK_BUFFER_SIZE);
+  ~StreamSink();
+
+protected:
+  void writeOut(const char* s, const size_t n);
+
+private:
+  std::ostream& m_stream;
+};
+
+// writes to a file
+class FileSink : public OutputSink {
+public:
+  FileSink(const std::string& filename, const int flushPolicy = SINK_FLUSH_ON_SIZE, const size_t flushSize = SINK_BUFFER_SIZE);
+  ~FileSink();
+
+  bool is_open() const;
+
+protected:
+  void writeOut(const char* s, const size_t n);
+
+private:
+  std::ofstream m_file;
+};
+
+// keeps everything written in memory
+class MemorySink : public OutputSink {
+public:
+  MemorySink();
+  ~MemorySink();
+
+  // returns everything written, flushing the sink first
+  const std::string& getData();
+
+protected:
+  void writeOut(const char* s, const size_t n);
+
+private:
+  std::string m_data;
+};
+
+#endif
\ No newline at end of file
@@ -1,1295 +1,2395 @@
-#include "ProgramExecutor.h"
-
-#include <cmath>
-
-using namespace std;
-
-vector<Rung> ProgramExecutor::s_program;
-int ProgramExecutor::s_bureaucrat;
-int ProgramExecutor::s_delegate;
-int ProgramExecutor::s_inputCounter;
-int ProgramExecutor::s_executionCounter;
-
-bool ProgramExecutor::s_wasBureaucratChanged;
-bool ProgramExecutor::s_areExecutionsDumped = false;
-bool ProgramExecutor::s_areVariableExecutionsDumped = false;
-
-map<string, Variable> ProgramExecutor::s_variables;
-
-ofstream ProgramExecutor::logFileStream;
-
-static Variable DNE_variable = Variable();
-
-std::string rungTypeToString(const char rungType) {
-  switch (rungType) {
-  case RUNG_TYPE_COMMAND:
-    return "COMMAND";
-  case RUNG_TYPE_VARIABLE:
-    return "VARIABLE";
-  case RUNG_TYPE_LITERAL:
-    return "LITERAL";
-  case RUNG_TYPE_PUNCTUATION:
-    return "PUNCTUATION";
-  default:
-    return "INVALID_TYPE";
-  }
-}
-string rungCommandToString(const double rungValue) {
-  switch ((int)rungValue) {
-  case RESERVED_WORD_SOME:
-    return "SOME";
-  case RESERVED_WORD_MANY:
-    return "MANY";
-  case RESERVED_WORD_HEAVEN:
-    return "HEAVEN";
-  case RESERVED_WORD_PROMOTE:
-    return "PROMOTE";
-  case RESERVED_WORD_DEMOTE:
-    return "DEMOTE";
-  case RESERVED_WORD_BLOSSOM:
-    return "BLOSSOM";
-  case RESERVED_WORD_RISE:
-    return "RISE";
-  case RESERVED_WORD_FALL:
-    return "FALL";
-  case RESERVED_WORD_LISTEN:
-    return "LISTEN";
-  case RESERVED_WORD_SPEAK:
-    return "SPEAK";
-  case RESERVED_WORD_COUNT:
-    return "COUNT";
-  case RESERVED_WORD_CREATE:
-    return "CREATE";
-  case RESERVED_WORD_DESTROY:
-    return "DESTROY";
-  case RESERVED_WORD_FEAR:
-    return "FEAR";
-  case RESERVED_WORD_LOVE:
-    return "LOVE";
-  case RESERVED_WORD_BECOME:
-    return "BECOME";
-  case RESERVED_WORD_LIKE:
-    return "LIKE";
-  case RESERVED_WORD_TOMORROW:
-    return "TOMORROW";
-  case RESERVED_WORD_NEGATIVE:
-    return "NEGATIVE";
-  case RESERVED_WORD_OPERATE:
-    return "OPERATE";
-  default:
-    return "INVALID_COMMAND";
-  }
-}
-
-void ProgramExecutor::loadProgram(const vector<HaifuToken>& tokens) {
-  std::vector<Rung> program_new;
-
-  s_program.clear();
-  s_variables.clear();
-
-  for (int i = 0; i < (int)tokens.size(); i++) {
-    appendRung_token(tokens[i]);
-  }
-
-  reverse(s_program.begin(), s_program.end());
-}
-
-void ProgramExecutor::executeProgram(istream& input) {
-  s_bureaucrat = 0;
-  s_delegate = 0;
-  s_inputCounter = 0;
-  s_executionCounter = 0;
-  s_variables.clear();
-
-  output("Starting execution...\n");
-
-  if (s_areExecutionsDumped) {
-    logFileStream.open(EXECUTION_DUMP_FILE_STRING);
-    if (logFileStream.fail()) {
-      logFileStream.close();
-    }
-  }
-
-  while (s_bureaucrat < (int)s_program.size()) {
-    s_wasBureaucratChanged = false;
-
-    // if a quit condition is returned
-    if (executeRung(s_program[s_bureaucrat], input)) {
-      break;
-    }
-
-    if (!s_wasBureaucratChanged) {
-      s_bureaucrat += 1;
-    }
-  }
-
-  output(" ");
-  output(" ");
-  output("Done.");
-
-  if (s_areExecutionsDumped) {
-    logFileStream << " " << endl;
-    logFileStream << OUTPUT_LINE_STRING << endl;
-    logFileStream << "Termination:" << endl;
-    logFileStream << OUTPUT_LINE_STRING << endl;
-    outputProgram(logFileStream);
-
-    logFileStream << " " << endl;
-    logFileStream << OUTPUT_LINE_STRING << endl;
-    logFileStream << "Variables at termination:" << endl;
-    logFileStream << OUTPUT_LINE_STRING << endl;
-    outputVariables(logFileStream);
-    logFileStream << endl;
-
-    logFileStream.close();
-  }
-}
-
-int ProgramExecutor::toggleExecutionDump() {
-  if (s_areExecutionsDumped) {
-    if (s_areVariableExecutionsDumped) {
-      s_areVariableExecutionsDumped = false;
-      s_areExecutionsDumped = false;
-      return DUMP_NO_EXECUTIONS;
-    }
-    else {
-      s_areVariableExecutionsDumped = true;
-      return DUMP_ALL_EXECUTIONS;
-    }
-  }
-  else {
-    s_areExecutionsDumped = true;
-    s_areVariableExecutionsDumped = false;
-    return DUMP_NON_VARIABLE_EXECUTIONS;
-  }
-}
-
-void ProgramExecutor::output(const std::string& value) {
-  if (!value.empty()) {
-    cout << value << endl;
-  }
-}
-
-void ProgramExecutor::appendRung_token(const HaifuToken& token) {
-  switch (token.type) {
-  case TOKEN_TYPE_RESERVED_WORD:
-    s_program.push_back(
-      Rung(
-        token.lineNumber
-        , token.columnNumber
-        , token.name
-        , RUNG_TYPE_COMMAND
-        , token.value
-        , RUNG_ELEMENT_DEFAULT
-        )
-      )
-      ;
-    break;
-  case TOKEN_TYPE_VARIABLE:
-    s_program.push_back(
-      Rung(
-        token.lineNumber
-        , token.columnNumber
-        , token.name
-        , RUNG_TYPE_VARIABLE
-        , RUNG_VALUE_DEFAULT
-        , token.element
-        )
-      )
-      ;
-    break;
-  case TOKEN_TYPE_NUMBER:
-    s_program.push_back(
-      Rung(
-        token.lineNumber
-        , token.columnNumber
-        , token.name
-        , RUNG_TYPE_LITERAL
-        , token.value
-        , ELEM_EARTH
-        )
-      )
-      ;
-    break;
-  case TOKEN_TYPE_PUNCTUATION:
-    s_program.push_back(
-      Rung(
-        token.lineNumber
-        , token.columnNumber
-        , token.name
-        , RUNG_TYPE_PUNCTUATION
-        , RUNG_VALUE_DEFAULT
-        , RUNG_ELEMENT_DEFAULT
-        )
-      )
-      ;
-    break;
-  default:
-    cout << "Warning: token \"" << token.name << "\" has an unexpected rung type" << endl;
-  }
-}
-
-void ProgramExecutor::insertRung(const Rung& rung, const int index) {
-  if (index < 0 || index >= (int)s_program.size() + 1) {
-    return;
-  }
-
-  if (index <= s_bureaucrat) {
-    s_bureaucrat++;
-  }
-  if (index <= s_delegate) {
-    s_delegate++;
-  }
-
-  s_program.insert(s_program.begin() + index, rung);
-}
-void ProgramExecutor::removeRung(const int index) {
-  if (index < 0 || index >= (int)s_program.size()) {
-    return;
-  }
-
-  if (index < s_bureaucrat) {
-    s_bureaucrat--;
-  }
-  if (index < s_delegate) {
-    s_delegate--;
-  }
-
-  s_program.erase(s_program.begin() + index);
-}
-
-bool ProgramExecutor::executeRung(const Rung& rung, istream& input, const string& command_variable, const int index_command) {
-  bool shouldTerminate;
-
-  if (s_areExecutionsDumped) {
-    if (index_command < 0) {
-      logFileStream << endl;
-      logFileStream << OUTPUT_LINE_STRING << endl;
-      logFileStream << "Execution " << s_executionCounter << ":" << endl;
-      logFileStream << OUTPUT_LINE_STRING << endl;
-      outputProgram(logFileStream);
-
-      logFileStream << endl;
-      logFileStream << OUTPUT_LINE_STRING << endl;
-      logFileStream << "Variables at execution " << s_executionCounter << ":" << endl;
-      logFileStream << OUTPUT_LINE_STRING << endl;
-      outputVariables(logFileStream, command_variable, index_command);
-    }
-    else if (s_areVariableExecutionsDumped) {
-      logFileStream << endl;
-      logFileStream << OUTPUT_LINE_STRING << endl;
-      logFileStream << "Execution " << s_executionCounter << ", Execution of \"" << command_variable << "\":" << endl;
-      logFileStream << OUTPUT_LINE_STRING << endl;
-      outputProgram(logFileStream);
-
-      logFileStream << endl;
-      logFileStream << OUTPUT_LINE_STRING << endl;
-      logFileStream << "Variables at execution " << s_executionCounter << ", Execution of \"" << command_variable << "\":" << endl;
-      logFileStream << OUTPUT_LINE_STRING << endl;
-      outputVariables(logFileStream, command_variable, index_command);
-    }
-  }
-
-  s_executionCounter++;
-
-  switch (rung.type) {
-  case RUNG_TYPE_COMMAND:
-    shouldTerminate = executeRung_command(rung, input);
-    break;
-  case RUNG_TYPE_VARIABLE:
-    shouldTerminate = executeRung_variable(rung.name, input);
-    break;
-  case RUNG_TYPE_LITERAL:
-    shouldTerminate = false;
-    break;
-  case RUNG_TYPE_PUNCTUATION:
-    shouldTerminate = executeRung_punctuation();
-    break;
-  default:
-    cout << "Warning: unknown command \"" << rung.name << "\"" << endl;
-    shouldTerminate = false;
-    break;
-  }
-
-  return shouldTerminate;
-}
-bool ProgramExecutor::executeRung_variable(const string& rungName, istream& input) {
-  map<string, Variable>::iterator iter;
-  const vector<Rung>* commands;
-  const string variableName = getVariableName(rungName);
-
-  iter = s_variables.find(variableName);
-
-  if (iter != s_variables.end() && iter->second.isCommand) {
-    commands = &iter->second.commands;
-    for (int i = 0; i < (int)commands->size(); i++) {
-      // if rung should indicate program termination
-      if (executeRung(commands->at(i), input, variableName, i)) {
-        // return and indicate program termination
-        return true;
-      }
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::executeRung_punctuation() {
-  const Rung* rung_named;
-  const Rung* rung_current;
-  vector<Rung> commands;
-  Variable* variable;
-
-  if (s_bureaucrat + 1 >= (int)s_program.size()) {
-    cout << "Warning: punctuation at end of program" << endl;
-    return false;
-  }
-  else {
-    rung_named = &s_program[s_bureaucrat + 1];
-    for (s_bureaucrat += 2; s_bureaucrat < (int)s_program.size(); s_bureaucrat++) {
-      rung_current = &s_program[s_bureaucrat];
-      // end of command sequence
-      if (rung_current->type == RUNG_TYPE_PUNCTUATION
-        || haveSameName(*rung_named, *rung_current)
-        )
-      {
-        if (rung_named->type == RUNG_TYPE_VARIABLE) {
-          variable = getVariable(rung_named->name);
-          variable->isCommand = true;
-          variable->value = 0.0;
-          // initialize element of variable
-          if (variable->element == ELEM_NONE) {
-            variable->element = rung_named->element;
-          }
-          variable->commands = commands;
-        }
-        else {
-          cout << "Warning: command sequence cannot be stored as non-variable \""
-            << rung_named->name << "\"" << endl;
-        }
-        return false;
-      }
-      // append variableCommands
-      else {
-        commands.push_back(*rung_current);
-      }
-    }
-  }
-
-  cout << "Warning: end of program was reached before command sequence ended" << endl;
-  return true;
-}
-bool ProgramExecutor::executeRung_command(const Rung& rung, istream& input) {
-  switch ((int)rung.value) {
-  case RESERVED_WORD_SOME:
-    return false;
-  case RESERVED_WORD_MANY:
-    return false;
-  case RESERVED_WORD_HEAVEN:
-    return command_heaven();
-  case RESERVED_WORD_PROMOTE:
-    return command_promote();
-  case RESERVED_WORD_DEMOTE:
-    return command_demote();
-  case RESERVED_WORD_BLOSSOM:
-    return command_blossom();
-  case RESERVED_WORD_RISE:
-    return command_rise();
-  case RESERVED_WORD_FALL:
-    return command_fall();
-  case RESERVED_WORD_LISTEN:
-    return command_listen(input);
-  case RESERVED_WORD_SPEAK:
-    return command_speak();
-  case RESERVED_WORD_COUNT:
-    return command_count();
-  case RESERVED_WORD_CREATE:
-    return command_create();
-  case RESERVED_WORD_DESTROY:
-    return command_destroy();
-  case RESERVED_WORD_FEAR:
-    return command_fear();
-  case RESERVED_WORD_LOVE:
-    return command_love();
-  case RESERVED_WORD_BECOME:
-    return command_become();
-  case RESERVED_WORD_LIKE:
-    return command_like();
-  case RESERVED_WORD_TOMORROW:
-    return command_tomorrow();
-  case RESERVED_WORD_NEGATIVE:
-    return command_negative();
-  case RESERVED_WORD_OPERATE:
-    return command_operate();
-  default:
-    cout << "Warning: command \"" << rung.name << "\" cannot be executed" << endl;
-    return false;
-  }
-}
-
-bool ProgramExecutor::isNumeric_store(const Rung& rung, double& value) {
-  const Variable* variable;
-  double commandRungValue;
-
-  switch (rung.type) {
-  case RUNG_TYPE_COMMAND:
-    commandRungValue = getCommandValue((int)rung.value);
-    if (commandRungValue == RUNG_COMMAND_VALUE_DEFAULT) {
-      return false;
-    }
-    else {
-      value = commandRungValue;
-      return true;
-    }
-  case RUNG_TYPE_VARIABLE:
-    variable = getExistingVariable(rung.name);
-    if (variable == &DNE_variable || variable->isCommand) {
-      value = RUNG_VALUE_DEFAULT;
-      return false;
-    }
-    else {
-      value = variable->value;
-      return true;
-    }
-  case RUNG_TYPE_LITERAL:
-    value = rung.value;
-    return true;
-  case RUNG_TYPE_PUNCTUATION:
-    value = RUNG_VALUE_DEFAULT;
-    return false;
-  default:
-    value = RUNG_VALUE_DEFAULT;
-    return false;
-  }
-}
-bool ProgramExecutor::isNumeric_store(const int programIndex, double& value) {
-  const Rung* rung = &s_program[programIndex];
-  const Variable* variable;
-  double commandRungValue;
-
-  switch (rung->type) {
-  case RUNG_TYPE_COMMAND:
-    commandRungValue = getCommandValue((int)rung->value);
-    if (commandRungValue == RUNG_COMMAND_VALUE_DEFAULT) {
-      return false;
-    }
-    else {
-      value = commandRungValue;
-      return true;
-    }
-  case RUNG_TYPE_VARIABLE:
-    variable = getExistingVariable(rung->name);
-    if (variable == &DNE_variable || variable->isCommand) {
-      value = RUNG_VALUE_DEFAULT;
-      return false;
-    }
-    else {
-      value = variable->value;
-      return true;
-    }
-  case RUNG_TYPE_LITERAL:
-    value = rung->value;
-    return true;
-  case RUNG_TYPE_PUNCTUATION:
-    value = RUNG_VALUE_DEFAULT;
-    return false;
-  default:
-    value = RUNG_VALUE_DEFAULT;
-    return false;
-  }
-}
-
-bool ProgramExecutor::haveSameName(const Rung& rung0, const Rung& rung1) {
-  return
-    // commands with the same code
-    (rung0.type == RUNG_TYPE_VARIABLE && rung1.type == RUNG_TYPE_VARIABLE
-      && getVariableName(rung0.name) == getVariableName(rung1.name)
-      )
-    // commands with the same code
-    || (rung0.type == RUNG_TYPE_COMMAND
-      && rung1.type == RUNG_TYPE_COMMAND
-      && rung0.value == rung1.value
-      )
-    // literals with the same value
-    || (rung0.type == RUNG_TYPE_LITERAL
-      && rung1.type == RUNG_TYPE_LITERAL
-      && rung0.value == rung1.value
-      )
-    ;
-}
-
-char ProgramExecutor::yin_yang(const double value) {
-  return (int)round_away(value) % 2 == 0 ? YIN : YANG;
-}
-
-double ProgramExecutor::getCommandValue(const int commandCode) {
-  switch (commandCode) {
-  case RESERVED_WORD_SOME:
-    return rand() % RAND_MAX_SOME + 1;
-  case RESERVED_WORD_MANY:
-    return rand() % (RAND_MAX_MANY - RAND_MAX_SOME) + RAND_MAX_SOME + 1;
-  default:
-    return RUNG_VALUE_DEFAULT;
-  }
-}
-
-char ProgramExecutor::getRungElement(const Rung& rung) {
-  Variable* variable;
-
-  if (rung.type == RUNG_TYPE_VARIABLE) {
-    variable = getExistingVariable(rung.name);
-    if (variable == &DNE_variable) {
-      return rung.element;
-    }
-    else {
-      return variable->element;
-    }
-  }
-  else {
-    return rung.element;
-  }
-}
-
-Variable* ProgramExecutor::getVariable(const std::string& rungName) {
-  return &s_variables[getVariableName(rungName)];
-}
-
-Variable* ProgramExecutor::getExistingVariable(const std::string& rungName) {
-  map<string, Variable>::iterator iter;
-  iter = s_variables.find(getVariableName(rungName));
-  if (iter == s_variables.end()) {
-    return &DNE_variable;
-  }
-
-  return &iter->second;
-}
-
-const string& ProgramExecutor::getVariableName(const string& rungName) {
-  const string& baseWordString = $WD::lookup(rungName).baseWord;
-  if (baseWordString == BASE_WORD_DEFAULT || baseWordString == BASE_WORD_IDENTITY) {
-    return rungName;
-  }
-  else {
-    return baseWordString;
-  }
-}
-
-void ProgramExecutor::assignRungValue(Rung& rung, const double value) {
-  Variable* variable;
-
-  switch (rung.type) {
-  case RUNG_TYPE_VARIABLE:
-    variable = getVariable(rung.name);
-    variable->isCommand = false;
-    variable->value = value;
-    // initializes the element of the variable to that of the word
-    if (variable->element == ELEM_NONE) {
-      variable->element = ELEM_EARTH;
-    }
-    else {
-      variable->element = rung.element;
-    }
-    variable->commands.clear();
-    break;
-  case RUNG_TYPE_LITERAL:
-    rung.value = value;
-    break;
-  default:
-    ;
-  }
-}
-
-bool ProgramExecutor::areOperatorsInRange() {
-  if (s_delegate + 1 >= (int)s_program.size()) {
-    //TODO: make error
-    return false;
-  }
-  else {
-    return true;
-  }
-}
-
-bool ProgramExecutor::command_heaven() {
-  return true;
-}
-bool ProgramExecutor::command_promote() {
-  double value;
-
-  if (isNumeric_store(s_delegate, value)) {
-    if (value == 0.0) {
-      return false;
-    }
-    s_wasBureaucratChanged = true;
-
-    if (value < 0) {
-      cout << "Warning: Bureaucrat promoted by a negative value" << endl;
-    }
-
-    s_bureaucrat += (int)round_away(value);
-
-    if (s_bureaucrat >= (int)s_program.size()) {
-      cout << "Warning: Bureaucrat promoted above the program" << endl;
-      s_bureaucrat = (int)s_program.size();
-      return true;
-    }
-    else if (s_bureaucrat < 0) {
-      cout << "Warning: Bureaucrat promoted below the program" << endl;
-      s_bureaucrat = 0;
-    }
-
-    if (s_delegate > s_bureaucrat) {
-      s_delegate = s_bureaucrat;
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_demote() {
-  double value;
-
-  if (isNumeric_store(s_delegate, value)) {
-    if (value == 0.0) {
-      return false;
-    }
-    s_wasBureaucratChanged = true;
-
-    if (value < 0) {
-      cout << "Warning: Bureaucrat demoted by a negative value" << endl;
-    }
-
-    s_bureaucrat -= (int)round_away(value);
-
-    if (s_bureaucrat >= (int)s_program.size()) {
-      cout << "Warning: Bureaucrat demoted above the program" << endl;
-      s_bureaucrat = (int)s_program.size();
-      return true;
-    }
-    else if (s_bureaucrat < 0) {
-      cout << "Warning: Bureaucrat demoted below the program" << endl;
-      s_bureaucrat = 0;
-    }
-
-    if (s_delegate > s_bureaucrat) {
-      s_delegate = s_bureaucrat;
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_blossom() {
-  double value;
-
-  if (isNumeric_store(s_delegate, value)) {
-    value = round_away(value);
-    if (yin_yang((int)value) == YIN) {
-      s_bureaucrat += (int)value;
-    }
-    else {
-      s_bureaucrat -= (int)value;
-    }
-
-    if (s_bureaucrat >= (int)s_program.size()) {
-      cout << "Warning: Bureaucrat blossomed to above the program" << endl;
-      s_bureaucrat = (int)s_program.size();
-      return true;
-    }
-    else if (s_bureaucrat < 0) {
-      cout << "Warning: Bureaucrat blossomed to below the program" << endl;
-      s_bureaucrat = 0;
-    }
-
-    if (s_delegate > s_bureaucrat) {
-      s_delegate = s_bureaucrat;
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_rise() {
-  double value;
-  if (s_bureaucrat == 0) {
-    value = 1.0;
-  }
-  else if (!isNumeric_store(s_bureaucrat - 1, value)) {
-    value = 1.0;
-  }
-
-  value = round_away(value);
-
-  if (value < 0.0) {
-    cout << "Warning: Delegate rose by a negative value" << endl;
-  }
-
-  s_delegate += (int)value;
-
-  if (s_delegate < 0) {
-    cout << "Warning: Delegate rose to below the program" << endl;
-    s_delegate = 0;
-  }
-
-  if (s_delegate > s_bureaucrat) {
-    cout << "Warning: Delegate rose to above the delegate" << endl;
-    s_delegate = s_bureaucrat;
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_fall() {
-  double value;
-  if (s_bureaucrat == 0) {
-    value = 1.0;
-  }
-  else if (!isNumeric_store(s_bureaucrat - 1, value)) {
-    value = 1.0;
-  }
-
-  value = round_away(value);
-
-  if (value < 0.0) {
-    cout << "Warning: Delegate fell by a negative value" << endl;
-  }
-
-  s_delegate -= (int)value;
-
-  if (s_delegate < 0) {
-    cout << "Warning: Delegate fell to below the program" << endl;
-    s_delegate = 0;
-  }
-
-  if (s_delegate > s_bureaucrat) {
-    cout << "Warning: Delegate fell to above the delegate" << endl;
-    s_delegate = s_bureaucrat;
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_listen(std::istream& input) {
-  bool isNumber;
-
-  char input_char;
-  char next_char;
-
-  int input_int_whole;
-  int input_int_fractional;
-  int input_int_fractional_size = 0;
-
-  double input_double;
-
-  string input_string;
-  string input_string_partial;
-  string input_int_fractional_string;
-
-  stringstream itoa_stream;
-
-  Rung swappedRung;
-
-  if (endOfStream(input)) {
-    if (s_bureaucrat + 1 < (int)s_program.size()) {
-      swappedRung = s_program[s_bureaucrat + 1];
-      removeRung(s_bureaucrat + 1);
-      insertRung(swappedRung, 0);
-    }
-  }
-  else {
-    // get the first character in case input is not a number, and backtrack
-    input >> input_char;
-    input.unget();
-
-    // see if the first part of the stream is formatted like an int
-    input >> input_int_whole;
-    if (input.fail()) {
-      // if not, input is not a number
-      isNumber = false;
-      // clear error flags
-      input.clear();
-      if (input_char != '+' && input_char != '-') {
-        // backtrack in case the istream removed a '-'
-        input.get();
-      }
-    }
-    else {
-      // the first part of the stream is formatted like an int,
-      //   so input is a number
-      isNumber = true;
-      // see what the next character is
-      next_char = input.get();
-      if (next_char != '.') {
-        // if it is not a '.', the input number does not have a fractional part
-        input_int_fractional = 0;
-        // backtrack past '.' since is not part of the input
-        input.putback(next_char);
-      }
-      else {
-        // the next character is '.',
-        //   so the input number could have a fractional part
-        next_char = input.peek();
-        // check if the next peeked character is a numeral
-        if (next_char >= '0' && next_char <= '9') {
-          // if so, the number of characters in the fractional part relates to its value
-          while (next_char >= '0' && next_char <= '9') {
-            // keep track of all the numerals
-            input_int_fractional_string.push_back(next_char);
-
-            input.get();
-            next_char = input.peek();
-          }
-
-          input_int_fractional_size = (int)input_int_fractional_string.size();
-
-          // put back all the numerals
-          for (int i = (int)input_int_fractional_string.size() - 1; i >= 0; i--) {
-            input.putback(input_int_fractional_string[i]);
-          }
-
-          // stream out these numerals to an int
-          input >> input_int_fractional;
-        }
-        // the next peeked character is not a numeral
-        else {
-          // so the input has no fractional part
-          input_int_fractional = 0;
-          // backtrack past the '.' since it is not part of the input
-          input.putback('.');
-        }
-      }
-    }
-
-    // if the input is a number
-    if (isNumber) {
-      // convert whole part to string
-      itoa_stream.clear();
-      itoa_stream << input_int_whole;
-      itoa_stream >> input_string;
-
-      // convert whole part to double
-      input_double = input_int_whole;
-
-      if (input_int_fractional != 0) {
-        // convert fractional part to string
-        itoa_stream.clear();
-        itoa_stream << input_int_fractional;
-        itoa_stream >> input_string_partial;
-
-        // append fractional string
-        input_string.push_back('.');
-        input_string += input_string_partial;
-
-        // divide fractional part by 10^(its size) and combine it with the whole part
-        if (input_double >= 0.0) {
-          input_double += input_int_fractional / pow(10.0, (int)input_int_fractional_string.size());
-        }
-        else {
-          input_double -= input_int_fractional / pow(10.0, (int)input_int_fractional_string.size());
-        }
-      }
-
-      // insert the Rung at the beginning of the program
-      insertRung(
-        Rung(INPUT_LINE_NUMBER, s_inputCounter, input_string, RUNG_TYPE_LITERAL, input_double, ELEM_EARTH)
-        , 0
-        );
-
-      // add 1 to the recorded number of input operations
-      s_inputCounter++;
-    }
-    else {
-      // set the string to contain only the input character
-      input_string.push_back(input_char);
-      // insert the Rung at the beginning of the program
-      insertRung(
-        Rung(INPUT_LINE_NUMBER, s_inputCounter, input_string, RUNG_TYPE_LITERAL, input_char, ELEM_EARTH)
-        , 0
-        );
-
-      // add 1 to the recorded number of input operations
-      s_inputCounter++;
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_speak() {
-  double value;
-  string valueString;
-
-  if (isNumeric_store(s_delegate, value)) {
-    valueString.push_back((char)(int)round_away(value));
-    cout << valueString;
-
-    if (s_areExecutionsDumped) {
-      logFileStream << endl;
-      logFileStream << "Output: \"" << valueString << "\"" << endl;
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_count() {
-  double value;
-  stringstream valueStream;
-  string valueString;
-
-  if (isNumeric_store(s_delegate, value)) {
-    valueStream << value;
-    valueStream >> valueString;
-    cout << valueString;
-
-    if (s_areExecutionsDumped) {
-      logFileStream << endl;
-      logFileStream << "Output: \"" << valueString << "\"" << endl;
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_create() {
-  double value;
-  Rung* rung;
-  Variable* variable;
-
-  rung = &s_program[s_delegate];
-  if (isNumeric_store(*rung, value)) {
-    switch (rung->type) {
-    case RUNG_TYPE_VARIABLE:
-      variable = getExistingVariable(rung->name);
-      if (variable != &DNE_variable) {
-        variable->element = progressElement_create(variable->element);
-      }
-      break;
-    case RUNG_TYPE_LITERAL:
-      rung->element = progressElement_create(rung->element);
-      break;
-    default:
-      ;
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_destroy() {
-  double value;
-  Rung* rung;
-  Variable* variable;
-
-  rung = &s_program[s_delegate];
-  if (isNumeric_store(*rung, value)) {
-    switch (rung->type) {
-    case RUNG_TYPE_VARIABLE:
-      variable = getExistingVariable(rung->name);
-      if (variable != &DNE_variable) {
-        variable->element = progressElement_destroy(variable->element);
-      }
-      break;
-    case RUNG_TYPE_LITERAL:
-      rung->element = progressElement_destroy(rung->element);
-      break;
-    default:
-      ;
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_fear() {
-  double value;
-  Rung* rung;
-  Variable* variable;
-
-  rung = &s_program[s_delegate];
-  if (isNumeric_store(*rung, value)) {
-    switch (rung->type) {
-    case RUNG_TYPE_VARIABLE:
-      variable = getExistingVariable(rung->name);
-      if (variable != &DNE_variable) {
-        variable->element = progressElement_fear(variable->element);
-      }
-      break;
-    case RUNG_TYPE_LITERAL:
-      rung->element = progressElement_fear(rung->element);
-      break;
-    default:
-      ;
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_love() {
-  double value;
-  Rung* rung;
-  Variable* variable;
-
-  rung = &s_program[s_delegate];
-  if (isNumeric_store(*rung, value)) {
-    switch (rung->type) {
-    case RUNG_TYPE_VARIABLE:
-      variable = getExistingVariable(rung->name);
-      if (variable != &DNE_variable) {
-        variable->element = progressElement_love(variable->element);
-      }
-      break;
-    case RUNG_TYPE_LITERAL:
-      rung->element = progressElement_love(rung->element);
-      break;
-    default:
-      ;
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_become() {
-  double value;
-  double value_new;
-  Rung* rung;
-  Variable* variable;
-
-  map<string, Variable>::iterator iter;
-
-  if (isNumeric_store(s_delegate, value)) {
-    rung = &s_program[s_delegate];
-
-    if (value == 0.0) {
-      rung->type = RUNG_TYPE_COMMAND;
-      rung->value = RESERVED_WORD_HEAVEN;
-      rung->element = ELEM_EARTH;
-    }
-    else {
-      value_new = round_away(value);
-      if (value == value_new) {
-        value = value < 0.0 ? value - 1.0 : value + 1.0;
-      }
-
-      switch (rung->type) {
-      case RUNG_TYPE_VARIABLE:
-        // variable already exists since it has a value
-        variable = getVariable(rung->name);
-        variable->value = value;
-        variable->element = progressElement_create(variable->element);
-        break;
-      case RUNG_TYPE_LITERAL:
-        rung->value = value;
-        break;
-      default:
-        ;
-      }
-    }
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_like() {
-  double value;
-  Rung* rung;
-  bool foundNumber = false;
-
-  if (s_bureaucrat - 1 < 0) {
-    return false;
-  }
-
-  rung = &s_program[s_bureaucrat - 1];
-  if (rung->type != RUNG_TYPE_VARIABLE) {
-    return false;
-  }
-
-  for (int i = s_delegate; i >= 0; i--) {
-    if (isNumeric_store(i, value)) {
-      foundNumber = true;
-      s_delegate = i;
-      break;
-    }
-  }
-
-  if (!foundNumber) {
-    value = 0.0;
-  }
-
-  assignRungValue(*rung, value);
-
-  return false;
-}
-bool ProgramExecutor::command_tomorrow() {
-  // definition is not in the specification
-
-  return false;
-}
-bool ProgramExecutor::command_negative() {
-  double value;
-  Rung* rung;
-
-  rung = &s_program[s_delegate];
-
-  if (isNumeric_store(*rung, value)) {
-    assignRungValue(*rung, -value);
-  }
-
-  return false;
-}
-bool ProgramExecutor::command_operate() {
-  if (!areOperatorsInRange()) {
-    command_heaven();
-  }
-
-  double value_A;
-  double value_B;
-
-  char element_A;
-  char element_B;
-
-  Rung* rung_A;
-  Rung* rung_B;
-
-  if (s_delegate + 1 >= (int)s_program.size()) {
-    return false;
-  }
-
-  rung_B = &s_program[s_delegate];
-  command_heaven();
-  if (!isNumeric_store(*rung_B, value_B)) {
-    command_heaven();
-    return false;
-  }
-
-  rung_A = &s_program[s_delegate + 1];
-  if (!isNumeric_store(*rung_A, value_A)) {
-    return false;
-  }
-
-  element_B = getRungElement(*rung_B);
-  element_A = getRungElement(*rung_A);
-
-  if (element_B == element_A) {
-    if (yin_yang(value_A) == YANG && yin_yang(value_B) == YANG) {
-      assignRungValue(*rung_B, YANG);
-    }
-    else {
-      assignRungValue(*rung_B, YIN);
-    }
-  }
-  else if (testElements_create(element_B, element_A)) {
-    assignRungValue(*rung_B, value_A + value_B);
-  }
-  else if (testElements_destroy(element_B, element_A)) {
-    assignRungValue(*rung_B, value_A - value_B);
-  }
-  else if (testElements_fear(element_B, element_A)) {
-    assignRungValue(*rung_B, value_A / value_B);
-  }
-  else if (testElements_love(element_B, element_A)) {
-    assignRungValue(*rung_B, value_A * value_B);
-  }
-  else {
-    cout << "Warning: unknown element relation for operation" << endl;
-  }
-
-  return false;
-}
-
-void ProgramExecutor::outputRung(const Rung& rung, std::ostream& output, const string& indent) {
-  map<string, Variable>::iterator iter;
-
-  if (rung.lineNumber == INPUT_LINE_NUMBER) {
-    output << "(INPUT, " << rung.columnNumber << ") ";
-  }
-  else {
-    output << "(" << rung.lineNumber << ", " << rung.columnNumber << ") ";
-  }
-  output << "\"" << rung.name << "\" ";
-  output << rungTypeToString(rung.type) << " ";
-  switch (rung.type) {
-  case RUNG_TYPE_COMMAND:
-    output << rungCommandToString(rung.value) << " ";
-    break;
-  case RUNG_TYPE_VARIABLE:
-    iter = s_variables.find(rung.name);
-    if (iter == s_variables.end()) {
-      output << "UNINITIALIZED";
-    }
-    else if (iter->second.isCommand) {
-      output << "COMMAND";
-    }
-    else {
-      output << "VALUE";
-    }
-    output << "_VARIABLE ";
-    break;
-  case RUNG_TYPE_LITERAL:
-    output << rung.value << " ";
-    break;
-  case RUNG_TYPE_PUNCTUATION:
-    output << rung.value << " ";
-    break;
-  default:
-    break;
-  }
-  output << toElementString(rung.element);
-}
-
-void ProgramExecutor::outputProgram(ostream& output) {
-  for (int i = (int)s_program.size()-1; i >= 0; i--) {
-    // indicates position of delegate
-    if (i == s_delegate) {
-      output << "D>";
-    }
-    else {
-      output << "  ";
-    }
-
-    // indicates position of bureaucrat
-    if (i == s_bureaucrat) {
-      output << "B>";
-    }
-    else {
-      output << "  ";
-    }
-
-    output << i << ": ";
-
-    outputRung(s_program[i], output);
-    output << endl;
-  }
-}
-
-void ProgramExecutor::outputVariable(const Variable& variable, ostream& output, const int index_command) {
-  const vector<Rung>* variableCommands;
-
-  if(variable.isCommand){
-    output << "COMMAND_VARIABLE ";
-    output << variable.value << " ";
-    output << toElementString(variable.element);
-    variableCommands = &variable.commands;
-    for (int i = (int)variableCommands->size() - 1; i >= 0; i--) {
-      output << endl;
-
-      // indicates position of indexed command
-      if (i == index_command) {
-        output << "  ->" << i << ": ";
-      }
-      else {
-        output << "    " << i << ": ";
-      }
-
-      outputRung((*variableCommands)[i], output);
-    }
-  }
-  else {
-    output << "VALUE_VARIABLE ";
-    output << variable.value << " ";
-    output << toElementString(variable.element);
-  }
-}
-
-void ProgramExecutor::outputVariables(ostream& output, const string& command_variable, const int index_command) {
-  map<string, Variable>::iterator iter;
-
-  for (iter = s_variables.begin(); iter != s_variables.end(); iter++) {
-    output << "  " << iter->first << ": ";
-    if (iter->first == command_variable) {
-      outputVariable(iter->second, output, index_command);
-    }
-    else {
-      outputVariable(iter->second, output);
-    }
-
-    output << endl;
-  }
+#include "ProgramExecutor.h"
+#include "ExecutionTrace.h"
+#include "ExecutionProfiler.h"
+#include "ExecutionCheckpoint.h"
+#include "ExecutionCycleDetector.h"
+
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+
+using namespace std;
+
+static Variable DNE_variable = Variable();
+
+atomic<bool> ProgramExecutor::s_isCheckpointRequested(false);
+
+std::string rungTypeToString(const char rungType) {
+  switch (rungType) {
+  case RUNG_TYPE_COMMAND:
+    return "COMMAND";
+  case RUNG_TYPE_VARIABLE:
+    return "VARIABLE";
+  case RUNG_TYPE_LITERAL:
+    return "LITERAL";
+  case RUNG_TYPE_PUNCTUATION:
+    return "PUNCTUATION";
+  default:
+    return "INVALID_TYPE";
+  }
+}
+string rungCommandToString(const double rungValue) {
+  switch ((int)rungValue) {
+  case RESERVED_WORD_SOME:
+    return "SOME";
+  case RESERVED_WORD_MANY:
+    return "MANY";
+  case RESERVED_WORD_HEAVEN:
+    return "HEAVEN";
+  case RESERVED_WORD_PROMOTE:
+    return "PROMOTE";
+  case RESERVED_WORD_DEMOTE:
+    return "DEMOTE";
+  case RESERVED_WORD_BLOSSOM:
+    return "BLOSSOM";
+  case RESERVED_WORD_RISE:
+    return "RISE";
+  case RESERVED_WORD_FALL:
+    return "FALL";
+  case RESERVED_WORD_LISTEN:
+    return "LISTEN";
+  case RESERVED_WORD_SPEAK:
+    return "SPEAK";
+  case RESERVED_WORD_COUNT:
+    return "COUNT";
+  case RESERVED_WORD_CREATE:
+    return "CREATE";
+  case RESERVED_WORD_DESTROY:
+    return "DESTROY";
+  case RESERVED_WORD_FEAR:
+    return "FEAR";
+  case RESERVED_WORD_LOVE:
+    return "LOVE";
+  case RESERVED_WORD_BECOME:
+    return "BECOME";
+  case RESERVED_WORD_LIKE:
+    return "LIKE";
+  case RESERVED_WORD_TOMORROW:
+    return "TOMORROW";
+  case RESERVED_WORD_NEGATIVE:
+    return "NEGATIVE";
+  case RESERVED_WORD_OPERATE:
+    return "OPERATE";
+  default:
+    return "INVALID_COMMAND";
+  }
+}
+string executionStatusToString(const int status) {
+  switch (status) {
+  case EXECUTION_STATUS_DONE:
+    return "DONE";
+  case EXECUTION_STATUS_STEP_BUDGET:
+    return "STEP_BUDGET";
+  case EXECUTION_STATUS_TIME_BUDGET:
+    return "TIME_BUDGET";
+  case EXECUTION_STATUS_CANCELLED:
+    return "CANCELLED";
+  case EXECUTION_STATUS_BAD_CHECKPOINT:
+    return "BAD_CHECKPOINT";
+  case EXECUTION_STATUS_CYCLE:
+    return "CYCLE";
+  case EXECUTION_STATUS_MEMORY_BUDGET:
+    return "MEMORY_BUDGET";
+  default:
+    return "INVALID_STATUS";
+  }
+}
+string memoryStructureToString(const int structure) {
+  switch (structure) {
+  case MEMORY_STRUCTURE_PROGRAM:
+    return "program";
+  case MEMORY_STRUCTURE_RUNGS:
+    return "rung table";
+  case MEMORY_STRUCTURE_VARIABLES:
+    return "variables";
+  case MEMORY_STRUCTURE_COMMAND_SEQUENCES:
+    return "command sequences";
+  case MEMORY_STRUCTURE_COMMAND_FRAMES:
+    return "command frames";
+  default:
+    return "INVALID_STRUCTURE";
+  }
+}
+char opcodeToRungType(const char opcode) {
+  switch (opcode) {
+  case OPCODE_UNDEFINED:
+    return RUNG_TYPE_UNDEFINED;
+  case OPCODE_LITERAL:
+    return RUNG_TYPE_LITERAL;
+  case OPCODE_VARIABLE:
+    return RUNG_TYPE_VARIABLE;
+  case OPCODE_PUNCTUATION:
+    return RUNG_TYPE_PUNCTUATION;
+  default:
+    return RUNG_TYPE_COMMAND;
+  }
+}
+
+ProgramExecutor::ProgramExecutor(ostream& output)
+  : m_streamSink(new StreamSink(output))
+  , m_sink(m_streamSink.get())
+  , m_output(m_sink)
+  , m_isCancelRequested(false)
+  , m_logFileStream(&m_logWriter)
+  , m_traceStream(&m_traceWriter)
+{
+  initialize();
+}
+
+ProgramExecutor::ProgramExecutor(OutputSink& sink)
+  : m_sink(&sink)
+  , m_output(&sink)
+  , m_isCancelRequested(false)
+  , m_logFileStream(&m_logWriter)
+  , m_traceStream(&m_traceWriter)
+{
+  initialize();
+}
+
+ProgramExecutor::~ProgramExecutor() {
+}
+
+void ProgramExecutor::initialize() {
+  m_bureaucrat = 0;
+  m_delegate = 0;
+  m_inputCounter = 0;
+  m_executionCounter = 0;
+
+  m_stepBudget = EXECUTION_BUDGET_NONE;
+  m_timeBudget = EXECUTION_BUDGET_NONE;
+  m_memoryBudget = EXECUTION_BUDGET_NONE;
+  m_budgetCheckCounter = 0;
+  m_status = EXECUTION_STATUS_DONE;
+
+  m_seed = 0;
+  m_isSeedFixed = false;
+  m_isRandom = false;
+
+  m_checkpointInterval = CHECKPOINT_INTERVAL_NONE;
+  m_nextCheckpoint = 0;
+  m_input = NULL;
+
+  m_wasBureaucratChanged = false;
+  m_areExecutionsDumped = false;
+  m_areVariableExecutionsDumped = false;
+
+  m_logPolicy = LOG_POLICY_BLOCK;
+
+  m_isExecutionTraced = false;
+  m_traceBureaucrat = 0;
+  m_traceDelegate = 0;
+
+  m_rungBytes = 0;
+  m_peakMemory = 0;
+  m_memoryCheckCounter = 0;
+}
+
+void ProgramExecutor::loadProgram(const vector<HaifuToken>& tokens, const vector<string>& sourceLines) {
+  getDefault().load(tokens, sourceLines);
+}
+
+int ProgramExecutor::executeProgram(istream& input) {
+  return getDefault().execute(input);
+}
+
+int ProgramExecutor::executeProgram(InputReader& input) {
+  return getDefault().execute(input);
+}
+
+int ProgramExecutor::resumeProgram(const string& checkpointFilename, InputReader& input) {
+  return getDefault().resume(checkpointFilename, input);
+}
+
+void ProgramExecutor::setExecutionBudgets(const long long stepBudget, const double timeBudget, const long long memoryBudget) {
+  getDefault().setBudgets(stepBudget, timeBudget, memoryBudget);
+}
+
+void ProgramExecutor::setExecutionSeed(const unsigned long long seed) {
+  getDefault().setSeed(seed);
+}
+
+void ProgramExecutor::clearExecutionSeed() {
+  getDefault().clearSeed();
+}
+
+bool ProgramExecutor::isProgramRandom() {
+  return getDefault().isRandom();
+}
+
+unsigned long long ProgramExecutor::getExecutionSeed() {
+  return getDefault().getSeed();
+}
+
+int ProgramExecutor::toggleExecutionDump() {
+  return getDefault().toggleDump();
+}
+
+bool ProgramExecutor::toggleExecutionTrace() {
+  return getDefault().toggleTrace();
+}
+
+int ProgramExecutor::toggleExecutionLogPolicy() {
+  return getDefault().toggleLogPolicy();
+}
+
+bool ProgramExecutor::toggleExecutionProfile() {
+  return getDefault().toggleProfile();
+}
+
+bool ProgramExecutor::toggleExecutionCycleDetection() {
+  return getDefault().toggleCycleDetection();
+}
+
+void ProgramExecutor::setExecutionCheckpoint(const string& filename, const long long interval) {
+  getDefault().setCheckpoint(filename, interval);
+}
+
+void ProgramExecutor::requestCheckpoint() {
+  s_isCheckpointRequested = true;
+}
+
+ProgramExecutor& ProgramExecutor::getDefault() {
+  static ProgramExecutor executor;
+
+  return executor;
+}
+
+void ProgramExecutor::load(const vector<HaifuToken>& tokens, const vector<string>& sourceLines) {
+  m_rungs.clear();
+  m_sourceLines = sourceLines;
+  m_program.clear();
+  m_variables.clear();
+  m_variableNames.clear();
+  m_variableSlots.clear();
+  m_commandSequences.clear();
+  m_builtCommandSequences.clear();
+
+  m_rungs.reserve(tokens.size());
+
+  for (int i = 0; i < (int)tokens.size(); i++) {
+    appendRung_token(tokens[i]);
+  }
+
+  reverse(m_program.begin(), m_program.end());
+
+  selectHandlers();
+
+  m_isRandom = false;
+  for (int i = 0; i < (int)m_program.size(); i++) {
+    // (listen only adds literals, so the program never gains some or many)
+    if (m_program[i].opcode == RESERVED_WORD_SOME || m_program[i].opcode == RESERVED_WORD_MANY) {
+      m_isRandom = true;
+    }
+  }
+
+  m_sink->flush();
+}
+
+int ProgramExecutor::execute(istream& input) {
+  InputReader reader(input);
+
+  return execute(reader);
+}
+
+int ProgramExecutor::execute(InputReader& input) {
+  m_bureaucrat = 0;
+  m_delegate = 0;
+  m_inputCounter = 0;
+  m_executionCounter = 0;
+  m_variables.assign(m_variableNames.size(), Variable());
+  clearCommandSequences();
+
+  if (!m_isSeedFixed) {
+    m_seed = makeRandomSeed();
+  }
+  m_random.seed(m_seed);
+
+  output("Starting execution...\n");
+
+  return run(input);
+}
+
+int ProgramExecutor::resume(const string& checkpointFilename, InputReader& input) {
+  ifstream checkpointFile(checkpointFilename.c_str(), ios::binary);
+  InputPosition inputPosition;
+
+  if (!checkpointFile.is_open()) {
+    m_output << "Error: unable to open checkpoint \"" << checkpointFilename << "\"" << endl;
+    m_sink->flush();
+    return EXECUTION_STATUS_BAD_CHECKPOINT;
+  }
+  if (!ExecutionCheckpoint::read(checkpointFile, *this, inputPosition)) {
+    m_output << "Error: \"" << checkpointFilename << "\" is not a valid checkpoint" << endl;
+    m_sink->flush();
+    return EXECUTION_STATUS_BAD_CHECKPOINT;
+  }
+  if (!input.restorePosition(inputPosition)) {
+    m_output << "Error: the input ends before the position saved in \"" << checkpointFilename << "\"" << endl;
+    m_sink->flush();
+    return EXECUTION_STATUS_BAD_CHECKPOINT;
+  }
+
+  m_output << "Resuming execution after " << m_executionCounter << " executions..." << endl;
+
+  return run(input);
+}
+
+int ProgramExecutor::run(InputReader& input) {
+  m_status = EXECUTION_STATUS_DONE;
+  m_isCancelRequested = false;
+  m_deadline = chrono::steady_clock::now() + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(m_timeBudget));
+  // the first check sets when the budgets are checked after it
+  m_budgetCheckCounter = 0;
+  m_nextCheckpoint = m_executionCounter + m_checkpointInterval;
+  m_input = &input;
+
+  // (the rung table of a resumed execution was read with the checkpoint)
+  m_rungBytes = 0;
+  for (int i = 0; i < (int)m_rungs.size(); i++) {
+    m_rungBytes += getRungBytes(m_rungs[i]);
+  }
+  m_peakMemory = 0;
+  measureMemory();
+  m_memoryUsage_start = m_memoryUsage;
+  m_memoryCheckCounter = m_executionCounter;
+
+  if (m_areExecutionsDumped) {
+    m_logWriter.open(EXECUTION_DUMP_FILE_STRING, false, m_logPolicy);
+  }
+
+  if (m_isExecutionTraced) {
+    m_traceWriter.open(EXECUTION_TRACE_FILE_STRING, true, m_logPolicy);
+    traceHeader();
+  }
+
+  if (m_profiler) {
+    m_profiler->reset();
+  }
+
+  if (m_cycleDetector) {
+    m_cycleDetector->reset(*this);
+  }
+
+#ifdef USE_RUNG_DISPATCH
+  if (true) {
+#else
+  if (m_areExecutionsDumped || m_isExecutionTraced || m_profiler) {
+#endif
+    while (m_bureaucrat < (int)m_program.size()) {
+      m_wasBureaucratChanged = false;
+
+      // if a quit condition is returned
+      if (executeRung(m_program[m_bureaucrat], input)) {
+        break;
+      }
+
+      if (!m_wasBureaucratChanged) {
+        m_bureaucrat += 1;
+      }
+    }
+  }
+  else {
+    executeInstructions(input);
+  }
+
+  if (m_status != EXECUTION_STATUS_DONE) {
+    m_output << endl;
+    m_output << "Warning: execution stopped by " << executionStatusToString(m_status) << " after " << m_executionCounter << " executions" << endl;
+
+    if (m_status == EXECUTION_STATUS_CYCLE) {
+      m_output << "Warning: the state of the execution recurred after " << m_cycleDetector->getCycleLength()
+        << " executions without reading input or writing output" << endl;
+    }
+    if (m_status == EXECUTION_STATUS_MEMORY_BUDGET) {
+      int structure_grown = MEMORY_STRUCTURE_PROGRAM;
+
+      m_output << "Warning: the execution held " << m_memoryUsage.getTotal() << " bytes, over its budget of " << m_memoryBudget << " bytes" << endl;
+      for (int i = 0; i < MEMORY_STRUCTURE_COUNT; i++) {
+        m_output << "  " << memoryStructureToString(i) << ": " << m_memoryUsage.bytes[i]
+          << " bytes (" << m_memoryUsage_start.bytes[i] << " when it started)" << endl;
+
+        if (m_memoryUsage.bytes[i] - m_memoryUsage_start.bytes[i] > m_memoryUsage.bytes[structure_grown] - m_memoryUsage_start.bytes[structure_grown]) {
+          structure_grown = i;
+        }
+      }
+      if (m_memoryUsage.bytes[structure_grown] > m_memoryUsage_start.bytes[structure_grown]) {
+        m_output << "Warning: the " << memoryStructureToString(structure_grown) << " grew the most" << endl;
+      }
+      else {
+        m_output << "Warning: the execution was over its budget when it started" << endl;
+      }
+    }
+  }
+
+  output(" ");
+  output(" ");
+  output("Done.");
+
+  if (m_areExecutionsDumped) {
+    outputTermination(m_logFileStream);
+    m_logWriter.close();
+
+    if (m_logWriter.getDroppedCount() > 0) {
+      m_output << "Warning: " << m_logWriter.getDroppedCount() << " bytes of the execution log were dropped" << endl;
+    }
+  }
+
+  if (m_isExecutionTraced) {
+    traceEnd();
+    m_traceWriter.close();
+
+    if (m_traceWriter.getDroppedCount() > 0) {
+      m_output << "Warning: " << m_traceWriter.getDroppedCount() << " bytes of the execution trace were dropped" << endl;
+    }
+    m_traceSequenceIds.clear();
+    m_traceSequences.clear();
+  }
+
+  if (m_profiler) {
+    ofstream profileFile(EXECUTION_PROFILE_FILE_STRING);
+
+    m_profiler->writeReport(profileFile, m_rungs);
+
+    if (!m_sourceLines.empty()) {
+      ofstream heatMapFile(EXECUTION_HEAT_MAP_FILE_STRING);
+      ofstream heatMapFile_HTML(EXECUTION_HEAT_MAP_HTML_FILE_STRING);
+
+      m_profiler->writeHeatMap_TXT(heatMapFile, m_rungs, m_sourceLines);
+      m_profiler->writeHeatMap_HTML(heatMapFile_HTML, m_rungs, m_sourceLines);
+    }
+  }
+
+  measureMemory();
+
+  m_input = NULL;
+  m_sink->flush();
+
+  return m_status;
+}
+
+void ProgramExecutor::setBudgets(const long long stepBudget, const double timeBudget, const long long memoryBudget) {
+  m_stepBudget = stepBudget;
+  m_timeBudget = timeBudget;
+  m_memoryBudget = memoryBudget;
+}
+
+void ProgramExecutor::cancel() {
+  m_isCancelRequested = true;
+}
+
+long long ProgramExecutor::getExecutionCount() const {
+  return m_executionCounter;
+}
+
+long long ProgramExecutor::getPeakMemory() const {
+  return m_peakMemory;
+}
+
+void ProgramExecutor::setCheckpoint(const string& filename, const long long interval) {
+  m_checkpointFilename = filename;
+  m_checkpointInterval = interval;
+}
+
+void ProgramExecutor::setSeed(const unsigned long long seed) {
+  m_seed = seed;
+  m_isSeedFixed = true;
+}
+
+void ProgramExecutor::clearSeed() {
+  m_isSeedFixed = false;
+}
+
+unsigned long long ProgramExecutor::getSeed() const {
+  return m_seed;
+}
+
+bool ProgramExecutor::isRandom() const {
+  return m_isRandom;
+}
+
+int ProgramExecutor::toggleDump() {
+  if (m_areExecutionsDumped) {
+    if (m_areVariableExecutionsDumped) {
+      m_areVariableExecutionsDumped = false;
+      m_areExecutionsDumped = false;
+      return DUMP_NO_EXECUTIONS;
+    }
+    else {
+      m_areVariableExecutionsDumped = true;
+      return DUMP_ALL_EXECUTIONS;
+    }
+  }
+  else {
+    m_areExecutionsDumped = true;
+    m_areVariableExecutionsDumped = false;
+    return DUMP_NON_VARIABLE_EXECUTIONS;
+  }
+}
+
+bool ProgramExecutor::toggleTrace() {
+  m_isExecutionTraced = !m_isExecutionTraced;
+  return m_isExecutionTraced;
+}
+
+bool ProgramExecutor::toggleProfile() {
+  if (m_profiler) {
+    m_profiler.reset();
+  }
+  else {
+    m_profiler.reset(new ExecutionProfiler());
+  }
+
+  return (bool)m_profiler;
+}
+
+bool ProgramExecutor::toggleCycleDetection() {
+  if (m_cycleDetector) {
+    m_cycleDetector.reset();
+  }
+  else {
+    m_cycleDetector.reset(new ExecutionCycleDetector());
+  }
+
+  return (bool)m_cycleDetector;
+}
+
+int ProgramExecutor::toggleLogPolicy() {
+  if (m_logPolicy == LOG_POLICY_BLOCK) {
+    m_logPolicy = LOG_POLICY_DROP;
+  }
+  else {
+    m_logPolicy = LOG_POLICY_BLOCK;
+  }
+
+  return m_logPolicy;
+}
+
+void ProgramExecutor::output(const std::string& value) {
+  if (!value.empty()) {
+    m_output << value << endl;
+  }
+}
+
+void ProgramExecutor::appendRung_token(const HaifuToken& token) {
+  switch (token.type) {
+  case TOKEN_TYPE_RESERVED_WORD:
+    m_program.push_back(
+      compileRung(
+        Rung(
+          token.lineNumber
+          , token.columnNumber
+          , token.name
+          , RUNG_TYPE_COMMAND
+          , token.value
+          , RUNG_ELEMENT_DEFAULT
+          )
+        )
+      )
+      ;
+    break;
+  case TOKEN_TYPE_VARIABLE:
+    m_program.push_back(
+      compileRung(
+        Rung(
+          token.lineNumber
+          , token.columnNumber
+          , token.name
+          , RUNG_TYPE_VARIABLE
+          , RUNG_VALUE_DEFAULT
+          , token.element
+          , getVariableName(token.name)
+          )
+        )
+      )
+      ;
+    break;
+  case TOKEN_TYPE_NUMBER:
+    m_program.push_back(
+      compileRung(
+        Rung(
+          token.lineNumber
+          , token.columnNumber
+          , token.name
+          , RUNG_TYPE_LITERAL
+          , token.value
+          , ELEM_EARTH
+          )
+        )
+      )
+      ;
+    break;
+  case TOKEN_TYPE_PUNCTUATION:
+    m_program.push_back(
+      compileRung(
+        Rung(
+          token.lineNumber
+          , token.columnNumber
+          , token.name
+          , RUNG_TYPE_PUNCTUATION
+          , RUNG_VALUE_DEFAULT
+          , RUNG_ELEMENT_DEFAULT
+          )
+        )
+      )
+      ;
+    break;
+  default:
+    m_output << "Warning: token \"" << token.name << "\" has an unexpected rung type" << endl;
+  }
+}
+
+Instruction ProgramExecutor::compileRung(const Rung& rung) {
+  Instruction instruction;
+
+  instruction.rung = (int)m_rungs.size();
+  instruction.element = rung.element;
+  m_rungs.push_back(rung);
+  m_rungBytes += getRungBytes(rung);
+  traceRung(rung);
+
+  switch (rung.type) {
+  case RUNG_TYPE_COMMAND:
+    if (rung.value >= RESERVED_WORD_SOME && rung.value <= RESERVED_WORD_OPERATE) {
+      instruction.opcode = (char)rung.value;
+    }
+    break;
+  case RUNG_TYPE_VARIABLE:
+    instruction.opcode = OPCODE_VARIABLE;
+    instruction.operand = getVariableSlot(rung.variableName);
+    break;
+  case RUNG_TYPE_LITERAL:
+    instruction.opcode = OPCODE_LITERAL;
+    instruction.value = rung.value;
+    break;
+  case RUNG_TYPE_PUNCTUATION:
+    instruction.opcode = OPCODE_PUNCTUATION;
+    instruction.operand = (int)m_commandSequences.size();
+    instruction.value = rung.value;
+    m_commandSequences.push_back(CommandSequenceCache());
+    break;
+  default:
+    ;
+  }
+
+  instruction.handler = instruction.opcode;
+  return instruction;
+}
+
+int ProgramExecutor::getVariableSlot(const string& variableName) {
+  map<string, int>::iterator iter;
+
+  iter = m_variableSlots.find(variableName);
+  if (iter != m_variableSlots.end()) {
+    return iter->second;
+  }
+
+  m_variableNames.push_back(variableName);
+  m_variableSlots[variableName] = (int)m_variableNames.size() - 1;
+  return (int)m_variableNames.size() - 1;
+}
+
+void ProgramExecutor::insertRung(const Instruction& instruction, const int index) {
+  if (index < 0 || index >= (int)m_program.size() + 1) {
+    return;
+  }
+
+  if (index <= m_bureaucrat) {
+    m_bureaucrat++;
+  }
+  if (index <= m_delegate) {
+    m_delegate++;
+  }
+
+  m_program.insert(m_program.begin() + index, instruction);
+  invalidateCommandSequences(index, 1);
+  if (m_cycleDetector) {
+    m_cycleDetector->invalidateProgram();
+  }
+  updateHandlers(index);
+  traceInsert(index);
+}
+void ProgramExecutor::removeRung(const int index) {
+  if (index < 0 || index >= (int)m_program.size()) {
+    return;
+  }
+
+  if (index < m_bureaucrat) {
+    m_bureaucrat--;
+  }
+  if (index < m_delegate) {
+    m_delegate--;
+  }
+
+  m_program.erase(m_program.begin() + index);
+  invalidateCommandSequences(index, -1);
+  if (m_cycleDetector) {
+    m_cycleDetector->invalidateProgram();
+  }
+  updateHandlers(index);
+  traceRemove(index);
+}
+
+bool ProgramExecutor::isWithoutEffect(const char opcode) {
+  switch (opcode) {
+  case RESERVED_WORD_SOME:
+  case RESERVED_WORD_MANY:
+  case RESERVED_WORD_TOMORROW:
+  case OPCODE_LITERAL:
+    return true;
+  default:
+    return false;
+  }
+}
+
+char ProgramExecutor::selectSuperinstruction(const int index) {
+  const char opcode = m_program[index].opcode;
+  const char opcode_next = index + 1 < (int)m_program.size() ? m_program[index + 1].opcode : OPCODE_UNDEFINED;
+  const char opcode_after = index + 2 < (int)m_program.size() ? m_program[index + 2].opcode : OPCODE_UNDEFINED;
+
+  // the most frequent sequences of the example programs
+  switch (opcode) {
+  case OPCODE_LITERAL:
+    if (opcode_next == RESERVED_WORD_RISE) {
+      return HANDLER_LITERAL_RISE;
+    }
+    if (opcode_next == RESERVED_WORD_FALL) {
+      return HANDLER_LITERAL_FALL;
+    }
+    if (opcode_next == OPCODE_LITERAL && opcode_after == RESERVED_WORD_RISE) {
+      return HANDLER_LITERAL_LITERAL_RISE;
+    }
+    if (opcode_next == OPCODE_LITERAL && opcode_after == RESERVED_WORD_FALL) {
+      return HANDLER_LITERAL_LITERAL_FALL;
+    }
+    break;
+  case OPCODE_VARIABLE:
+    if (opcode_next == RESERVED_WORD_SPEAK) {
+      return HANDLER_VARIABLE_SPEAK;
+    }
+    break;
+  default:
+    ;
+  }
+
+  return opcode;
+}
+void ProgramExecutor::selectHandler(const int index) {
+  Instruction& instruction = m_program[index];
+  const int skipLength_next = index + 1 < (int)m_program.size() ? m_program[index + 1].skipLength : 0;
+
+  instruction.handler = selectSuperinstruction(index);
+
+  // a stretch of rungs without effect ends at the first rung with one or that starts a superinstruction
+  if (instruction.handler == instruction.opcode && isWithoutEffect(instruction.opcode)) {
+    instruction.skipLength = (char)min(skipLength_next + 1, SKIP_LENGTH_MAX);
+  }
+  else {
+    instruction.skipLength = 0;
+  }
+
+  if (instruction.skipLength > 1) {
+    instruction.handler = HANDLER_SKIP;
+  }
+}
+void ProgramExecutor::selectHandlers() {
+  for (int i = (int)m_program.size() - 1; i >= 0; i--) {
+    selectHandler(i);
+  }
+}
+void ProgramExecutor::updateHandlers(const int index) {
+  int first = max(0, index - SUPERINSTRUCTION_LENGTH_MAX + 1);
+
+  // the stretch that reaches the rung is passed over from its first rung
+  //   (a longer stretch is split, and the part of it this far back is not changed)
+  while (first > 0 && index - first < SKIP_LENGTH_MAX + SUPERINSTRUCTION_LENGTH_MAX && isWithoutEffect(m_program[first - 1].opcode)) {
+    first--;
+  }
+
+  for (int i = min(index, (int)m_program.size() - 1); i >= first; i--) {
+    selectHandler(i);
+  }
+}
+
+void ProgramExecutor::invalidateCommandSequences(const int index, const int shift) {
+  CommandSequenceCache* cache;
+  // (a rung inserted at the punctuation goes before it, so it is not part of the sequence)
+  const int offset = shift > 0 ? 1 : 0;
+
+  for (int i = 0; i < (int)m_builtCommandSequences.size(); ) {
+    cache = &m_commandSequences[m_builtCommandSequences[i]];
+
+    if (index >= cache->start + offset && index <= cache->start + cache->length) {
+      *cache = CommandSequenceCache();
+      m_builtCommandSequences[i] = m_builtCommandSequences.back();
+      m_builtCommandSequences.pop_back();
+    }
+    else {
+      if (index < cache->start + offset) {
+        cache->start += shift;
+      }
+      i++;
+    }
+  }
+}
+
+void ProgramExecutor::clearCommandSequences() {
+  for (int i = 0; i < (int)m_builtCommandSequences.size(); i++) {
+    m_commandSequences[m_builtCommandSequences[i]] = CommandSequenceCache();
+  }
+  m_builtCommandSequences.clear();
+}
+
+bool ProgramExecutor::isOverBudget(const bool isBetweenRungs) {
+  bool isCheckpointDue;
+
+  if (m_stepBudget != EXECUTION_BUDGET_NONE && m_executionCounter >= m_stepBudget) {
+    m_status = EXECUTION_STATUS_STEP_BUDGET;
+    return true;
+  }
+  if (m_isCancelRequested) {
+    m_status = EXECUTION_STATUS_CANCELLED;
+    return true;
+  }
+  if (m_timeBudget != EXECUTION_BUDGET_NONE && chrono::steady_clock::now() >= m_deadline) {
+    m_status = EXECUTION_STATUS_TIME_BUDGET;
+    return true;
+  }
+  if (m_executionCounter >= m_memoryCheckCounter) {
+    measureMemory();
+    m_memoryCheckCounter = m_executionCounter + BUDGET_CHECK_INTERVAL;
+
+    if (m_memoryBudget != EXECUTION_BUDGET_NONE && m_memoryUsage.getTotal() > m_memoryBudget) {
+      m_status = EXECUTION_STATUS_MEMORY_BUDGET;
+      return true;
+    }
+  }
+  if (m_cycleDetector && isBetweenRungs && m_cycleDetector->check(*this)) {
+    m_status = EXECUTION_STATUS_CYCLE;
+    return true;
+  }
+
+  isCheckpointDue = !m_checkpointFilename.empty()
+    && (s_isCheckpointRequested || (m_checkpointInterval != CHECKPOINT_INTERVAL_NONE && m_executionCounter >= m_nextCheckpoint));
+  if (isCheckpointDue && isBetweenRungs) {
+    writeCheckpoint();
+    isCheckpointDue = false;
+  }
+
+  m_budgetCheckCounter = m_executionCounter + BUDGET_CHECK_INTERVAL;
+  if (m_stepBudget != EXECUTION_BUDGET_NONE && m_budgetCheckCounter > m_stepBudget) {
+    m_budgetCheckCounter = m_stepBudget;
+  }
+  if (m_checkpointInterval != CHECKPOINT_INTERVAL_NONE && !m_checkpointFilename.empty() && m_budgetCheckCounter > m_nextCheckpoint) {
+    m_budgetCheckCounter = m_nextCheckpoint;
+  }
+  // a checkpoint due within a command variable is written at the first rung of the program after it,
+  // and a cycle is looked for between every two rungs
+  if (isCheckpointDue || m_cycleDetector) {
+    m_budgetCheckCounter = m_executionCounter + 1;
+  }
+
+  return false;
+}
+
+void ProgramExecutor::writeCheckpoint() {
+  const string temporaryFilename = m_checkpointFilename + CHECKPOINT_TEMPORARY_SUFFIX_STRING;
+  bool isWritten;
+
+  s_isCheckpointRequested = false;
+  m_nextCheckpoint = m_executionCounter + m_checkpointInterval;
+
+  // what the program wrote before the checkpoint is not written again when it is resumed
+  m_sink->flush();
+
+  {
+    ofstream checkpointFile(temporaryFilename.c_str(), ios::binary);
+
+    ExecutionCheckpoint::write(checkpointFile, *this, m_input->getPosition());
+    checkpointFile.close();
+    isWritten = !checkpointFile.fail();
+  }
+
+  if (isWritten) {
+#ifdef _WIN32
+    // (rename does not replace a file on Windows)
+    remove(m_checkpointFilename.c_str());
+#endif
+    isWritten = rename(temporaryFilename.c_str(), m_checkpointFilename.c_str()) == 0;
+  }
+
+  if (!isWritten) {
+    m_output << "Warning: unable to write checkpoint \"" << m_checkpointFilename << "\"" << endl;
+    remove(temporaryFilename.c_str());
+  }
+}
+
+long long ProgramExecutor::getRungBytes(const Rung& rung) {
+  return (long long)(sizeof(Rung) + rung.name.capacity() + rung.variableName.capacity());
+}
+
+void ProgramExecutor::measureMemory() {
+  const vector<Instruction>* sequence;
+
+  m_memoryUsage.bytes[MEMORY_STRUCTURE_PROGRAM] = (long long)(m_program.size() * sizeof(Instruction));
+  m_memoryUsage.bytes[MEMORY_STRUCTURE_RUNGS] = m_rungBytes;
+  m_memoryUsage.bytes[MEMORY_STRUCTURE_VARIABLES] = (long long)(m_variables.size() * sizeof(Variable));
+
+  // the sequences stored by variables and kept by punctuation rungs, each once
+  m_measuredSequences.clear();
+  for (int i = 0; i < (int)m_variables.size(); i++) {
+    if (m_variables[i].commands) {
+      m_measuredSequences.push_back(m_variables[i].commands.get());
+    }
+  }
+  for (int i = 0; i < (int)m_builtCommandSequences.size(); i++) {
+    if (m_commandSequences[m_builtCommandSequences[i]].commands) {
+      m_measuredSequences.push_back(m_commandSequences[m_builtCommandSequences[i]].commands.get());
+    }
+  }
+  sort(m_measuredSequences.begin(), m_measuredSequences.end());
+
+  m_memoryUsage.bytes[MEMORY_STRUCTURE_COMMAND_SEQUENCES] = (long long)(m_commandSequences.size() * sizeof(CommandSequenceCache));
+  for (int i = 0; i < (int)m_measuredSequences.size(); i++) {
+    sequence = m_measuredSequences[i];
+    if (i == 0 || sequence != m_measuredSequences[i - 1]) {
+      m_memoryUsage.bytes[MEMORY_STRUCTURE_COMMAND_SEQUENCES] += (long long)(sizeof(vector<Instruction>) + sequence->capacity() * sizeof(Instruction));
+    }
+  }
+
+  m_memoryUsage.bytes[MEMORY_STRUCTURE_COMMAND_FRAMES] = (long long)(m_commandFrames.capacity() * sizeof(CommandFrame));
+
+  if (m_memoryUsage.getTotal() > m_peakMemory) {
+    m_peakMemory = m_memoryUsage.getTotal();
+  }
+}
+
+void ProgramExecutor::executeInstructions(InputReader& input) {
+#ifdef USE_THREADED_DISPATCH
+  // handlers indexed by opcode
+  static void* const handlers[HANDLER_COUNT] = {
+    &&handler_undefined
+    , &&handler_none          // RESERVED_WORD_SOME
+    , &&handler_none          // RESERVED_WORD_MANY
+    , &&handler_heaven
+    , &&handler_promote
+    , &&handler_demote
+    , &&handler_blossom
+    , &&handler_rise
+    , &&handler_fall
+    , &&handler_listen
+    , &&handler_speak
+    , &&handler_count
+    , &&handler_create
+    , &&handler_destroy
+    , &&handler_fear
+    , &&handler_love
+    , &&handler_become
+    , &&handler_like
+    , &&handler_tomorrow
+    , &&handler_negative
+    , &&handler_operate
+    , &&handler_none          // OPCODE_LITERAL
+    , &&handler_variable
+    , &&handler_punctuation
+    , &&handler_literal_rise
+    , &&handler_literal_fall
+    , &&handler_literal_literal_rise
+    , &&handler_literal_literal_fall
+    , &&handler_variable_speak
+    , &&handler_skip
+  };
+  const Instruction* instruction;
+
+  // jumps to the handler of the rung at the bureaucrat
+  //   (the budgets are checked only once the counter reaches the next check)
+#define DISPATCH() \
+  if (m_bureaucrat >= (int)m_program.size()) { \
+    return; \
+  } \
+  if (m_executionCounter >= m_budgetCheckCounter && isOverBudget(true)) { \
+    return; \
+  } \
+  m_wasBureaucratChanged = false; \
+  m_executionCounter++; \
+  instruction = &m_program[m_bureaucrat]; \
+  goto *handlers[(int)instruction->handler]
+
+  // skips the rungs that only precede the rest of a superinstruction
+#define ADVANCE(count) \
+  m_bureaucrat += count; \
+  m_executionCounter += count
+
+  // whether the rungs after the one dispatched can be skipped without passing the next budget check
+  //   (otherwise the rung is executed on its own, and the check is taken before the next)
+#define CAN_ADVANCE(count) (m_executionCounter + (count) <= m_budgetCheckCounter)
+
+  // executes a handler and moves on to the next rung
+#define EXECUTE(call) \
+  if (call) { \
+    return; \
+  } \
+  if (!m_wasBureaucratChanged) { \
+    m_bureaucrat += 1; \
+  } \
+  DISPATCH()
+
+  DISPATCH();
+
+handler_undefined:
+  EXECUTE(dispatchRung(*instruction, input));
+handler_none:
+  m_bureaucrat += 1;
+  DISPATCH();
+handler_heaven:
+  EXECUTE(command_heaven());
+handler_promote:
+  EXECUTE(command_promote());
+handler_demote:
+  EXECUTE(command_demote());
+handler_blossom:
+  EXECUTE(command_blossom());
+handler_rise:
+  EXECUTE(command_rise());
+handler_fall:
+  EXECUTE(command_fall());
+handler_listen:
+  EXECUTE(command_listen(input));
+handler_speak:
+  EXECUTE(command_speak());
+handler_count:
+  EXECUTE(command_count());
+handler_create:
+  EXECUTE(command_create());
+handler_destroy:
+  EXECUTE(command_destroy());
+handler_fear:
+  EXECUTE(command_fear());
+handler_love:
+  EXECUTE(command_love());
+handler_become:
+  EXECUTE(command_become());
+handler_like:
+  EXECUTE(command_like());
+handler_tomorrow:
+  EXECUTE(command_tomorrow());
+handler_negative:
+  EXECUTE(command_negative());
+handler_operate:
+  EXECUTE(command_operate());
+handler_variable:
+  EXECUTE(executeRung_variable(*instruction, input));
+handler_punctuation:
+  EXECUTE(executeRung_punctuation());
+
+  // superinstructions (rise and fall take the value of the literal under them)
+handler_literal_rise:
+  if (!CAN_ADVANCE(1)) {
+    goto handler_none;
+  }
+  ADVANCE(1);
+  EXECUTE(riseDelegate(m_program[m_bureaucrat - 1].value));
+handler_literal_fall:
+  if (!CAN_ADVANCE(1)) {
+    goto handler_none;
+  }
+  ADVANCE(1);
+  EXECUTE(fallDelegate(m_program[m_bureaucrat - 1].value));
+handler_literal_literal_rise:
+  if (!CAN_ADVANCE(2)) {
+    goto handler_none;
+  }
+  ADVANCE(2);
+  EXECUTE(riseDelegate(m_program[m_bureaucrat - 1].value));
+handler_literal_literal_fall:
+  if (!CAN_ADVANCE(2)) {
+    goto handler_none;
+  }
+  ADVANCE(2);
+  EXECUTE(fallDelegate(m_program[m_bureaucrat - 1].value));
+handler_variable_speak:
+  // a command variable is executed on its own
+  if (getExistingVariable(instruction->operand)->isCommand || !CAN_ADVANCE(1)) {
+    goto handler_variable;
+  }
+  ADVANCE(1);
+  EXECUTE(command_speak());
+handler_skip:
+  // a budget check that falls within the stretch is taken at the rung it falls after
+  if (CAN_ADVANCE(instruction->skipLength - 1)) {
+    ADVANCE(instruction->skipLength - 1);
+  }
+  m_bureaucrat += 1;
+  DISPATCH();
+
+#undef EXECUTE
+#undef CAN_ADVANCE
+#undef ADVANCE
+#undef DISPATCH
+#else
+  // superinstructions are only dispatched by the threaded loop
+  while (m_bureaucrat < (int)m_program.size()) {
+    if (m_executionCounter >= m_budgetCheckCounter && isOverBudget(true)) {
+      return;
+    }
+
+    m_wasBureaucratChanged = false;
+    m_executionCounter++;
+
+    // if a quit condition is returned
+    if (dispatchRung(m_program[m_bureaucrat], input)) {
+      return;
+    }
+
+    if (!m_wasBureaucratChanged) {
+      m_bureaucrat += 1;
+    }
+  }
+#endif
+}
+
+bool ProgramExecutor::executeRung(const Instruction& instruction, InputReader& input) {
+  bool isDone;
+
+  if (beginRung()) {
+    return true;
+  }
+
+  isDone = dispatchRung(instruction, input);
+  endRung(instruction, false);
+
+  return isDone;
+}
+bool ProgramExecutor::beginRung(const int command_variable, const int index_command) {
+  if (m_executionCounter >= m_budgetCheckCounter && isOverBudget(index_command < 0)) {
+    return true;
+  }
+
+  if (m_areExecutionsDumped && (index_command < 0 || m_areVariableExecutionsDumped)) {
+    outputExecution(m_logFileStream, command_variable, index_command);
+  }
+  traceStep(command_variable, index_command);
+
+  m_executionCounter++;
+
+  if (m_profiler) {
+    m_profiler->enterRung();
+  }
+
+  return false;
+}
+void ProgramExecutor::endRung(const Instruction& instruction, const bool isInVariable) {
+  if (m_profiler) {
+    m_profiler->exitRung(instruction, isInVariable);
+  }
+}
+bool ProgramExecutor::dispatchRung(const Instruction& instruction, InputReader& input) {
+  switch (instruction.opcode) {
+  case OPCODE_LITERAL:
+    return false;
+  case OPCODE_VARIABLE:
+    return executeRung_variable(instruction, input);
+  case OPCODE_PUNCTUATION:
+    return executeRung_punctuation();
+  case RESERVED_WORD_SOME:
+    return false;
+  case RESERVED_WORD_MANY:
+    return false;
+  case RESERVED_WORD_HEAVEN:
+    return command_heaven();
+  case RESERVED_WORD_PROMOTE:
+    return command_promote();
+  case RESERVED_WORD_DEMOTE:
+    return command_demote();
+  case RESERVED_WORD_BLOSSOM:
+    return command_blossom();
+  case RESERVED_WORD_RISE:
+    return command_rise();
+  case RESERVED_WORD_FALL:
+    return command_fall();
+  case RESERVED_WORD_LISTEN:
+    return command_listen(input);
+  case RESERVED_WORD_SPEAK:
+    return command_speak();
+  case RESERVED_WORD_COUNT:
+    return command_count();
+  case RESERVED_WORD_CREATE:
+    return command_create();
+  case RESERVED_WORD_DESTROY:
+    return command_destroy();
+  case RESERVED_WORD_FEAR:
+    return command_fear();
+  case RESERVED_WORD_LOVE:
+    return command_love();
+  case RESERVED_WORD_BECOME:
+    return command_become();
+  case RESERVED_WORD_LIKE:
+    return command_like();
+  case RESERVED_WORD_TOMORROW:
+    return command_tomorrow();
+  case RESERVED_WORD_NEGATIVE:
+    return command_negative();
+  case RESERVED_WORD_OPERATE:
+    return command_operate();
+  default:
+    m_output << "Warning: command \"" << m_rungs[instruction.rung].name << "\" cannot be executed" << endl;
+    return false;
+  }
+}
+bool ProgramExecutor::executeRung_variable(const Instruction& instruction, InputReader& input) {
+  const Variable* variable;
+  const Instruction* rung;
+  CommandFrame* frame;
+  bool isDone;
+  // the frames below are those of the variables that executed the rung, if a command variable did
+  const int depth = (int)m_commandFrames.size();
+
+  variable = getExistingVariable(instruction.operand);
+  if (!variable->isCommand) {
+    return false;
+  }
+  pushCommandFrame(instruction.operand, variable->commands);
+
+  while ((int)m_commandFrames.size() > depth) {
+    frame = &m_commandFrames.back();
+
+    // the rungs of a sequence can assign to its own variable, after which the variable goes on with what it holds
+    //   (a value ends it, and another sequence is executed from the index the old one had reached)
+    variable = getExistingVariable(frame->slot);
+    if (variable->isCommand && variable->commands != frame->commands) {
+      frame->commands = variable->commands;
+    }
+
+    // the end of a sequence ends the variable rung that entered it
+    if (!variable->isCommand || frame->index >= (int)frame->commands->size()) {
+      m_commandFrames.pop_back();
+      if ((int)m_commandFrames.size() > depth) {
+        frame = &m_commandFrames.back();
+        endRung((*frame->commands)[frame->index], true);
+        frame->index++;
+      }
+      continue;
+    }
+
+    // (the rung is in the held sequence, so it does not move as frames are pushed)
+    rung = &(*frame->commands)[frame->index];
+    if (beginRung(frame->slot, frame->index)) {
+      leaveCommandFrames(depth);
+      return true;
+    }
+
+    if (rung->opcode == OPCODE_VARIABLE) {
+      variable = getExistingVariable(rung->operand);
+      // a command variable is entered, and executed by this loop
+      if (variable->isCommand) {
+        pushCommandFrame(rung->operand, variable->commands);
+        continue;
+      }
+      isDone = false;
+    }
+    else {
+      isDone = dispatchRung(*rung, input);
+    }
+    endRung(*rung, true);
+
+    // if rung should indicate program termination
+    if (isDone) {
+      leaveCommandFrames(depth);
+      return true;
+    }
+
+    m_commandFrames.back().index++;
+  }
+
+  return false;
+}
+void ProgramExecutor::pushCommandFrame(const int slot, const CommandSequence& commands) {
+  // (command variables that execute each other without end would otherwise grow the frames past the memory budget
+  //  between two of its checks)
+  if (m_commandFrames.size() == m_commandFrames.capacity()) {
+    m_memoryCheckCounter = m_executionCounter;
+    m_budgetCheckCounter = m_executionCounter;
+  }
+
+  m_commandFrames.push_back(CommandFrame(slot, commands));
+}
+void ProgramExecutor::leaveCommandFrames(const int depth) {
+  const CommandFrame* frame;
+
+  while ((int)m_commandFrames.size() > depth) {
+    m_commandFrames.pop_back();
+    if ((int)m_commandFrames.size() > depth) {
+      frame = &m_commandFrames.back();
+      endRung((*frame->commands)[frame->index], true);
+    }
+  }
+}
+bool ProgramExecutor::executeRung_punctuation() {
+  const Instruction* rung_named;
+  const Instruction* rung_current;
+  vector<Instruction> commands;
+  CommandSequenceCache* cache = NULL;
+  const int index_punctuation = m_bureaucrat;
+
+  if (m_bureaucrat + 1 >= (int)m_program.size()) {
+    m_output << "Warning: punctuation at end of program" << endl;
+    return false;
+  }
+  else {
+    rung_named = &m_program[m_bureaucrat + 1];
+
+    // reuse the sequence if none of its rungs has changed since it was built
+    //   (the punctuation can also be reached through a command variable)
+    if (m_program[m_bureaucrat].opcode == OPCODE_PUNCTUATION) {
+      cache = &m_commandSequences[m_program[m_bureaucrat].operand];
+      if (cache->start == index_punctuation) {
+        m_bureaucrat += cache->length;
+        defineCommandVariable(*rung_named, cache->commands);
+        return false;
+      }
+    }
+
+    for (m_bureaucrat += 2; m_bureaucrat < (int)m_program.size(); m_bureaucrat++) {
+      rung_current = &m_program[m_bureaucrat];
+      // end of command sequence
+      if (rung_current->opcode == OPCODE_PUNCTUATION
+        || haveSameName(*rung_named, *rung_current)
+        )
+      {
+        CommandSequence sequence = make_shared<const vector<Instruction> >(move(commands));
+        if (cache != NULL) {
+          if (cache->start == COMMAND_SEQUENCE_START_NONE) {
+            m_builtCommandSequences.push_back(m_program[index_punctuation].operand);
+          }
+          cache->commands = sequence;
+          cache->start = index_punctuation;
+          cache->length = m_bureaucrat - index_punctuation;
+        }
+        defineCommandVariable(*rung_named, sequence);
+        return false;
+      }
+      // append variableCommands
+      else {
+        commands.push_back(*rung_current);
+      }
+    }
+  }
+
+  m_output << "Warning: end of program was reached before command sequence ended" << endl;
+  return true;
+}
+void ProgramExecutor::defineCommandVariable(const Instruction& rung_named, const CommandSequence& commands) {
+  Variable* variable;
+
+  if (rung_named.opcode == OPCODE_VARIABLE) {
+    variable = getVariable(rung_named.operand);
+    variable->isCommand = true;
+    variable->value = 0;
+    // initialize element of variable
+    if (variable->element == ELEM_NONE) {
+      variable->element = rung_named.element;
+    }
+    variable->commands = commands;
+    hashVariable(rung_named.operand);
+    traceVariable(rung_named.operand);
+  }
+  else {
+    m_output << "Warning: command sequence cannot be stored as non-variable \""
+      << m_rungs[rung_named.rung].name << "\"" << endl;
+  }
+}
+
+bool ProgramExecutor::isNumeric_store(const Instruction& instruction, RungValue& value) {
+  const Variable* variable;
+  RungValue commandRungValue;
+
+  switch (instruction.opcode) {
+  case OPCODE_LITERAL:
+    value = instruction.value;
+    return true;
+  case OPCODE_VARIABLE:
+    variable = getExistingVariable(instruction.operand);
+    if (variable == &DNE_variable || variable->isCommand) {
+      value = RUNG_VALUE_DEFAULT;
+      return false;
+    }
+    else {
+      value = variable->value;
+      return true;
+    }
+  case OPCODE_PUNCTUATION:
+    value = RUNG_VALUE_DEFAULT;
+    return false;
+  case OPCODE_UNDEFINED:
+    value = RUNG_VALUE_DEFAULT;
+    return false;
+  default:
+    commandRungValue = getCommandValue(instruction.opcode);
+    if (commandRungValue == RungValue(RUNG_COMMAND_VALUE_DEFAULT)) {
+      return false;
+    }
+    else {
+      value = commandRungValue;
+      return true;
+    }
+  }
+}
+bool ProgramExecutor::isNumeric_store(const int programIndex, RungValue& value) {
+  return isNumeric_store(m_program[programIndex], value);
+}
+
+bool ProgramExecutor::haveSameName(const Instruction& instruction0, const Instruction& instruction1) {
+  return
+    // variables with the same name
+    (instruction0.opcode == OPCODE_VARIABLE && instruction1.opcode == OPCODE_VARIABLE
+      && instruction0.operand == instruction1.operand
+      )
+    // literals with the same value
+    || (instruction0.opcode == OPCODE_LITERAL
+      && instruction1.opcode == OPCODE_LITERAL
+      && instruction0.value == instruction1.value
+      )
+    // commands with the same code
+    || (opcodeToRungType(instruction0.opcode) == RUNG_TYPE_COMMAND
+      && instruction0.opcode == instruction1.opcode
+      )
+    ;
+}
+
+char ProgramExecutor::yin_yang(const RungValue& value) {
+  return value.toInt_rounded() % 2 == 0 ? YIN : YANG;
+}
+
+RungValue ProgramExecutor::getCommandValue(const int commandCode) {
+  switch (commandCode) {
+  case RESERVED_WORD_SOME:
+    return RungValue((int)m_random.nextBelow(RAND_MAX_SOME) + 1);
+  case RESERVED_WORD_MANY:
+    return RungValue((int)m_random.nextBelow(RAND_MAX_MANY - RAND_MAX_SOME) + RAND_MAX_SOME + 1);
+  default:
+    return RungValue(RUNG_VALUE_DEFAULT);
+  }
+}
+
+char ProgramExecutor::getRungElement(const Instruction& instruction) {
+  Variable* variable;
+
+  if (instruction.opcode == OPCODE_VARIABLE) {
+    variable = getExistingVariable(instruction.operand);
+    if (variable == &DNE_variable) {
+      return instruction.element;
+    }
+    else {
+      return variable->element;
+    }
+  }
+  else {
+    return instruction.element;
+  }
+}
+
+Variable* ProgramExecutor::getVariable(const int slot) {
+  m_variables[slot].isDefined = true;
+  return &m_variables[slot];
+}
+
+Variable* ProgramExecutor::getExistingVariable(const int slot) {
+  if (!m_variables[slot].isDefined) {
+    return &DNE_variable;
+  }
+
+  return &m_variables[slot];
+}
+
+const string& ProgramExecutor::getVariableName(const string& rungName) {
+  const string& baseWordString = $WD::find(rungName).baseWord;
+  if (baseWordString == BASE_WORD_DEFAULT || baseWordString == BASE_WORD_IDENTITY) {
+    return rungName;
+  }
+  else {
+    return baseWordString;
+  }
+}
+
+void ProgramExecutor::assignRungValue(const int programIndex, const RungValue& value) {
+  Instruction& instruction = m_program[programIndex];
+  Variable* variable;
+
+  switch (instruction.opcode) {
+  case OPCODE_VARIABLE:
+    variable = getVariable(instruction.operand);
+    variable->isCommand = false;
+    variable->value = value;
+    // initializes the element of the variable to that of the word
+    if (variable->element == ELEM_NONE) {
+      variable->element = ELEM_EARTH;
+    }
+    else {
+      variable->element = instruction.element;
+    }
+    variable->commands.reset();
+    hashVariable(instruction.operand);
+    traceVariable(instruction.operand);
+    break;
+  case OPCODE_LITERAL:
+    instruction.value = value;
+    invalidateCommandSequences(programIndex);
+    hashRung(programIndex);
+    traceSet(programIndex);
+    break;
+  default:
+    ;
+  }
+}
+
+bool ProgramExecutor::areOperatorsInRange() {
+  if (m_delegate + 1 >= (int)m_program.size()) {
+    //TODO: make error
+    return false;
+  }
+  else {
+    return true;
+  }
+}
+
+bool ProgramExecutor::command_heaven() {
+  return true;
+}
+bool ProgramExecutor::command_promote() {
+  RungValue value;
+
+  if (isNumeric_store(m_delegate, value)) {
+    if (value.isZero()) {
+      return false;
+    }
+    m_wasBureaucratChanged = true;
+
+    if (value.isNegative()) {
+      m_output << "Warning: Bureaucrat promoted by a negative value" << endl;
+    }
+
+    m_bureaucrat += value.toInt_rounded();
+
+    if (m_bureaucrat >= (int)m_program.size()) {
+      m_output << "Warning: Bureaucrat promoted above the program" << endl;
+      m_bureaucrat = (int)m_program.size();
+      return true;
+    }
+    else if (m_bureaucrat < 0) {
+      m_output << "Warning: Bureaucrat promoted below the program" << endl;
+      m_bureaucrat = 0;
+    }
+
+    if (m_delegate > m_bureaucrat) {
+      m_delegate = m_bureaucrat;
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_demote() {
+  RungValue value;
+
+  if (isNumeric_store(m_delegate, value)) {
+    if (value.isZero()) {
+      return false;
+    }
+    m_wasBureaucratChanged = true;
+
+    if (value.isNegative()) {
+      m_output << "Warning: Bureaucrat demoted by a negative value" << endl;
+    }
+
+    m_bureaucrat -= value.toInt_rounded();
+
+    if (m_bureaucrat >= (int)m_program.size()) {
+      m_output << "Warning: Bureaucrat demoted above the program" << endl;
+      m_bureaucrat = (int)m_program.size();
+      return true;
+    }
+    else if (m_bureaucrat < 0) {
+      m_output << "Warning: Bureaucrat demoted below the program" << endl;
+      m_bureaucrat = 0;
+    }
+
+    if (m_delegate > m_bureaucrat) {
+      m_delegate = m_bureaucrat;
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_blossom() {
+  RungValue value;
+  int distance;
+
+  if (isNumeric_store(m_delegate, value)) {
+    distance = value.toInt_rounded();
+    if (distance % 2 == 0) {
+      m_bureaucrat += distance;
+    }
+    else {
+      m_bureaucrat -= distance;
+    }
+
+    if (m_bureaucrat >= (int)m_program.size()) {
+      m_output << "Warning: Bureaucrat blossomed to above the program" << endl;
+      m_bureaucrat = (int)m_program.size();
+      return true;
+    }
+    else if (m_bureaucrat < 0) {
+      m_output << "Warning: Bureaucrat blossomed to below the program" << endl;
+      m_bureaucrat = 0;
+    }
+
+    if (m_delegate > m_bureaucrat) {
+      m_delegate = m_bureaucrat;
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_rise() {
+  RungValue value;
+  if (m_bureaucrat == 0) {
+    value = 1;
+  }
+  else if (!isNumeric_store(m_bureaucrat - 1, value)) {
+    value = 1;
+  }
+
+  return riseDelegate(value);
+}
+bool ProgramExecutor::riseDelegate(const RungValue& value) {
+  const int distance = value.toInt_rounded();
+
+  if (value.isNegative()) {
+    m_output << "Warning: Delegate rose by a negative value" << endl;
+  }
+
+  m_delegate += distance;
+
+  if (m_delegate < 0) {
+    m_output << "Warning: Delegate rose to below the program" << endl;
+    m_delegate = 0;
+  }
+
+  if (m_delegate > m_bureaucrat) {
+    m_output << "Warning: Delegate rose to above the delegate" << endl;
+    m_delegate = m_bureaucrat;
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_fall() {
+  RungValue value;
+  if (m_bureaucrat == 0) {
+    value = 1;
+  }
+  else if (!isNumeric_store(m_bureaucrat - 1, value)) {
+    value = 1;
+  }
+
+  return fallDelegate(value);
+}
+bool ProgramExecutor::fallDelegate(const RungValue& value) {
+  const int distance = value.toInt_rounded();
+
+  if (value.isNegative()) {
+    m_output << "Warning: Delegate fell by a negative value" << endl;
+  }
+
+  m_delegate -= distance;
+
+  if (m_delegate < 0) {
+    m_output << "Warning: Delegate fell to below the program" << endl;
+    m_delegate = 0;
+  }
+
+  if (m_delegate > m_bureaucrat) {
+    m_output << "Warning: Delegate fell to above the delegate" << endl;
+    m_delegate = m_bureaucrat;
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_listen(InputReader& input) {
+  string input_string;
+  double input_double;
+
+  Instruction swappedRung;
+
+  // anything the program has written is shown before its input is typed
+  //   (input from a file or pipe is read without waiting for the output)
+  if (input.isInteractive()) {
+    m_sink->flush();
+  }
+
+  if (input.isEndOfInput()) {
+    if (m_bureaucrat + 1 < (int)m_program.size()) {
+      swappedRung = m_program[m_bureaucrat + 1];
+      removeRung(m_bureaucrat + 1);
+      insertRung(swappedRung, 0);
+    }
+  }
+  else {
+    // a number, or a single character if the input is not a number
+    input.readValue(input_string, input_double);
+
+    // insert the Rung at the beginning of the program
+    insertRung(
+      compileRung(Rung(INPUT_LINE_NUMBER, m_inputCounter, input_string, RUNG_TYPE_LITERAL, input_double, ELEM_EARTH))
+      , 0
+      );
+
+    // add 1 to the recorded number of input operations
+    m_inputCounter++;
+
+    // (the execution cannot return to a state before it read input)
+    if (m_cycleDetector) {
+      m_cycleDetector->restart();
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_speak() {
+  RungValue value;
+  char valueChar;
+
+  if (isNumeric_store(m_delegate, value)) {
+    valueChar = (char)value.toInt_rounded();
+    m_sink->write(valueChar);
+
+    if (m_areExecutionsDumped) {
+      m_logFileStream << endl;
+      m_logFileStream << "Output: \"" << valueChar << "\"" << endl;
+    }
+    if (m_traceWriter.is_open()) {
+      traceOutput(string(1, valueChar));
+    }
+    if (m_cycleDetector) {
+      m_cycleDetector->restart();
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_count() {
+  RungValue value;
+  char valueString[NUMBER_STRING_LENGTH_MAX];
+  int valueLength;
+
+  if (isNumeric_store(m_delegate, value)) {
+    valueLength = formatNumber(value, valueString);
+    m_sink->write(valueString, valueLength);
+
+    if (m_areExecutionsDumped) {
+      m_logFileStream << endl;
+      m_logFileStream << "Output: \"";
+      m_logFileStream.write(valueString, valueLength);
+      m_logFileStream << "\"" << endl;
+    }
+    if (m_traceWriter.is_open()) {
+      traceOutput(string(valueString, valueLength));
+    }
+    if (m_cycleDetector) {
+      m_cycleDetector->restart();
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_create() {
+  RungValue value;
+  Instruction* rung;
+  Variable* variable;
+
+  rung = &m_program[m_delegate];
+  if (isNumeric_store(*rung, value)) {
+    switch (rung->opcode) {
+    case OPCODE_VARIABLE:
+      variable = getExistingVariable(rung->operand);
+      if (variable != &DNE_variable) {
+        variable->element = progressElement_create(variable->element);
+        hashVariable(rung->operand);
+        traceVariable(rung->operand);
+      }
+      break;
+    case OPCODE_LITERAL:
+      rung->element = progressElement_create(rung->element);
+      invalidateCommandSequences(m_delegate);
+      hashRung(m_delegate);
+      traceSet(m_delegate);
+      break;
+    default:
+      ;
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_destroy() {
+  RungValue value;
+  Instruction* rung;
+  Variable* variable;
+
+  rung = &m_program[m_delegate];
+  if (isNumeric_store(*rung, value)) {
+    switch (rung->opcode) {
+    case OPCODE_VARIABLE:
+      variable = getExistingVariable(rung->operand);
+      if (variable != &DNE_variable) {
+        variable->element = progressElement_destroy(variable->element);
+        hashVariable(rung->operand);
+        traceVariable(rung->operand);
+      }
+      break;
+    case OPCODE_LITERAL:
+      rung->element = progressElement_destroy(rung->element);
+      invalidateCommandSequences(m_delegate);
+      hashRung(m_delegate);
+      traceSet(m_delegate);
+      break;
+    default:
+      ;
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_fear() {
+  RungValue value;
+  Instruction* rung;
+  Variable* variable;
+
+  rung = &m_program[m_delegate];
+  if (isNumeric_store(*rung, value)) {
+    switch (rung->opcode) {
+    case OPCODE_VARIABLE:
+      variable = getExistingVariable(rung->operand);
+      if (variable != &DNE_variable) {
+        variable->element = progressElement_fear(variable->element);
+        hashVariable(rung->operand);
+        traceVariable(rung->operand);
+      }
+      break;
+    case OPCODE_LITERAL:
+      rung->element = progressElement_fear(rung->element);
+      invalidateCommandSequences(m_delegate);
+      hashRung(m_delegate);
+      traceSet(m_delegate);
+      break;
+    default:
+      ;
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_love() {
+  RungValue value;
+  Instruction* rung;
+  Variable* variable;
+
+  rung = &m_program[m_delegate];
+  if (isNumeric_store(*rung, value)) {
+    switch (rung->opcode) {
+    case OPCODE_VARIABLE:
+      variable = getExistingVariable(rung->operand);
+      if (variable != &DNE_variable) {
+        variable->element = progressElement_love(variable->element);
+        hashVariable(rung->operand);
+        traceVariable(rung->operand);
+      }
+      break;
+    case OPCODE_LITERAL:
+      rung->element = progressElement_love(rung->element);
+      invalidateCommandSequences(m_delegate);
+      hashRung(m_delegate);
+      traceSet(m_delegate);
+      break;
+    default:
+      ;
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_become() {
+  RungValue value;
+  Instruction* rung;
+  Variable* variable;
+
+  if (isNumeric_store(m_delegate, value)) {
+    rung = &m_program[m_delegate];
+
+    if (value.isZero()) {
+      rung->opcode = RESERVED_WORD_HEAVEN;
+      rung->operand = INSTRUCTION_OPERAND_DEFAULT;
+      rung->element = ELEM_EARTH;
+      invalidateCommandSequences(m_delegate);
+      updateHandlers(m_delegate);
+      hashRung(m_delegate);
+      traceSet(m_delegate);
+    }
+    else {
+      // (a double that is not an integer is left as it is)
+      if (value.isInteger()) {
+        value = value.isNegative() ? value - RungValue(1) : value + RungValue(1);
+      }
+      else if (value.toDouble() == round_away(value.toDouble())) {
+        value = value.isNegative() ? RungValue(value.toDouble() - 1.0) : RungValue(value.toDouble() + 1.0);
+      }
+
+      switch (rung->opcode) {
+      case OPCODE_VARIABLE:
+        // variable already exists since it has a value
+        variable = getVariable(rung->operand);
+        variable->value = value;
+        variable->element = progressElement_create(variable->element);
+        hashVariable(rung->operand);
+        traceVariable(rung->operand);
+        break;
+      case OPCODE_LITERAL:
+        rung->value = value;
+        invalidateCommandSequences(m_delegate);
+        hashRung(m_delegate);
+        traceSet(m_delegate);
+        break;
+      default:
+        ;
+      }
+    }
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_like() {
+  RungValue value;
+  Instruction* rung;
+  bool foundNumber = false;
+
+  if (m_bureaucrat - 1 < 0) {
+    return false;
+  }
+
+  rung = &m_program[m_bureaucrat - 1];
+  if (rung->opcode != OPCODE_VARIABLE) {
+    return false;
+  }
+
+  for (int i = m_delegate; i >= 0; i--) {
+    if (isNumeric_store(i, value)) {
+      foundNumber = true;
+      m_delegate = i;
+      break;
+    }
+  }
+
+  if (!foundNumber) {
+    value = 0;
+  }
+
+  assignRungValue(m_bureaucrat - 1, value);
+
+  return false;
+}
+bool ProgramExecutor::command_tomorrow() {
+  // definition is not in the specification
+
+  return false;
+}
+bool ProgramExecutor::command_negative() {
+  RungValue value;
+  Instruction* rung;
+
+  rung = &m_program[m_delegate];
+
+  if (isNumeric_store(*rung, value)) {
+    assignRungValue(m_delegate, -value);
+  }
+
+  return false;
+}
+bool ProgramExecutor::command_operate() {
+  if (!areOperatorsInRange()) {
+    command_heaven();
+  }
+
+  RungValue value_A;
+  RungValue value_B;
+
+  char element_A;
+  char element_B;
+
+  int index_B;
+  Instruction* rung_A;
+  Instruction* rung_B;
+
+  if (m_delegate + 1 >= (int)m_program.size()) {
+    return false;
+  }
+
+  index_B = m_delegate;
+  rung_B = &m_program[index_B];
+  command_heaven();
+  if (!isNumeric_store(*rung_B, value_B)) {
+    command_heaven();
+    return false;
+  }
+
+  rung_A = &m_program[m_delegate + 1];
+  if (!isNumeric_store(*rung_A, value_A)) {
+    return false;
+  }
+
+  element_B = getRungElement(*rung_B);
+  element_A = getRungElement(*rung_A);
+
+  switch (getElementRelation(element_B, element_A)) {
+  case ELEM_RELATION_SAME:
+    if (yin_yang(value_A) == YANG && yin_yang(value_B) == YANG) {
+      assignRungValue(index_B, RungValue(YANG));
+    }
+    else {
+      assignRungValue(index_B, RungValue(YIN));
+    }
+    break;
+  case ELEM_RELATION_CREATE:
+    assignRungValue(index_B, value_A + value_B);
+    break;
+  case ELEM_RELATION_DESTROY:
+    assignRungValue(index_B, value_A - value_B);
+    break;
+  case ELEM_RELATION_FEAR:
+    assignRungValue(index_B, value_A / value_B);
+    break;
+  case ELEM_RELATION_LOVE:
+    assignRungValue(index_B, value_A * value_B);
+    break;
+  default:
+    m_output << "Warning: unknown element relation for operation" << endl;
+  }
+
+  return false;
+}
+
+void ProgramExecutor::outputExecution(ostream& output, const int command_variable, const int index_command) {
+  if (index_command < 0) {
+    output << endl;
+    output << OUTPUT_LINE_STRING << endl;
+    output << "Execution " << m_executionCounter << ":" << endl;
+    output << OUTPUT_LINE_STRING << endl;
+    outputProgram(output);
+
+    output << endl;
+    output << OUTPUT_LINE_STRING << endl;
+    output << "Variables at execution " << m_executionCounter << ":" << endl;
+    output << OUTPUT_LINE_STRING << endl;
+    outputVariables(output, command_variable, index_command);
+  }
+  else {
+    output << endl;
+    output << OUTPUT_LINE_STRING << endl;
+    output << "Execution " << m_executionCounter << ", Execution of ";
+    outputCommandFrames(output, command_variable);
+    output << ":" << endl;
+    output << OUTPUT_LINE_STRING << endl;
+    outputProgram(output);
+
+    output << endl;
+    output << OUTPUT_LINE_STRING << endl;
+    output << "Variables at execution " << m_executionCounter << ", Execution of ";
+    outputCommandFrames(output, command_variable);
+    output << ":" << endl;
+    output << OUTPUT_LINE_STRING << endl;
+    outputVariables(output, command_variable, index_command);
+  }
+}
+void ProgramExecutor::outputCommandFrames(ostream& output, const int command_variable) {
+  if (m_commandFrames.empty()) {
+    output << "\"" << m_variableNames[command_variable] << "\"";
+    return;
+  }
+
+  for (int i = (int)m_commandFrames.size() - 1; i >= 0; i--) {
+    output << "\"" << m_variableNames[m_commandFrames[i].slot] << "\"";
+    if (i > 0) {
+      output << " in ";
+    }
+  }
+}
+void ProgramExecutor::outputTermination(ostream& output) {
+  output << " " << endl;
+  output << OUTPUT_LINE_STRING << endl;
+  output << "Termination:" << endl;
+  output << OUTPUT_LINE_STRING << endl;
+  outputProgram(output);
+
+  output << " " << endl;
+  output << OUTPUT_LINE_STRING << endl;
+  output << "Variables at termination:" << endl;
+  output << OUTPUT_LINE_STRING << endl;
+  outputVariables(output);
+  output << endl;
+}
+
+void ProgramExecutor::traceHeader() {
+  if (!m_traceWriter.is_open()) {
+    return;
+  }
+
+  m_traceStream.write(EXECUTION_TRACE_MAGIC_STRING, sizeof(EXECUTION_TRACE_MAGIC_STRING) - 1);
+
+  writeTraceInt(m_traceStream, (long long)m_rungs.size());
+  for (int i = 0; i < (int)m_rungs.size(); i++) {
+    writeTraceRung(m_traceStream, m_rungs[i]);
+  }
+
+  writeTraceInt(m_traceStream, (long long)m_variableNames.size());
+  for (int i = 0; i < (int)m_variableNames.size(); i++) {
+    writeTraceString(m_traceStream, m_variableNames[i]);
+  }
+
+  writeTraceInt(m_traceStream, (long long)m_program.size());
+  for (int i = 0; i < (int)m_program.size(); i++) {
+    writeTraceInstruction(m_traceStream, m_program[i]);
+  }
+
+  m_traceBureaucrat = m_bureaucrat;
+  m_traceDelegate = m_delegate;
+}
+void ProgramExecutor::traceStep(const int command_variable, const int index_command) {
+  if (!m_traceWriter.is_open()) {
+    return;
+  }
+
+  // the bureaucrat and delegate are recorded by how far they moved since the last step
+  writeTraceInt(m_traceStream, TRACE_RECORD_STEP);
+  writeTraceInt(m_traceStream, m_executionCounter);
+  writeTraceInt(m_traceStream, command_variable);
+  writeTraceInt(m_traceStream, index_command);
+  // (the command variables executing the step, so that the replay can rebuild them from the innermost of each step)
+  writeTraceInt(m_traceStream, (long long)m_commandFrames.size());
+  writeTraceInt(m_traceStream, m_bureaucrat - m_traceBureaucrat);
+  writeTraceInt(m_traceStream, m_delegate - m_traceDelegate);
+
+  m_traceBureaucrat = m_bureaucrat;
+  m_traceDelegate = m_delegate;
+}
+void ProgramExecutor::traceRung(const Rung& rung) {
+  if (!m_traceWriter.is_open()) {
+    return;
+  }
+
+  writeTraceInt(m_traceStream, TRACE_RECORD_RUNG);
+  writeTraceRung(m_traceStream, rung);
+}
+void ProgramExecutor::traceInsert(const int index) {
+  if (!m_traceWriter.is_open()) {
+    return;
+  }
+
+  writeTraceInt(m_traceStream, TRACE_RECORD_INSERT);
+  writeTraceInt(m_traceStream, index);
+  writeTraceInstruction(m_traceStream, m_program[index]);
+}
+void ProgramExecutor::traceRemove(const int index) {
+  if (!m_traceWriter.is_open()) {
+    return;
+  }
+
+  writeTraceInt(m_traceStream, TRACE_RECORD_REMOVE);
+  writeTraceInt(m_traceStream, index);
+}
+void ProgramExecutor::traceSet(const int index) {
+  if (!m_traceWriter.is_open()) {
+    return;
+  }
+
+  writeTraceInt(m_traceStream, TRACE_RECORD_SET);
+  writeTraceInt(m_traceStream, index);
+  writeTraceInstruction(m_traceStream, m_program[index]);
+}
+void ProgramExecutor::traceVariable(const int slot) {
+  const Variable* variable;
+  map<const vector<Instruction>*, int>::iterator iter;
+  int sequenceId = TRACE_SEQUENCE_NONE;
+
+  if (!m_traceWriter.is_open()) {
+    return;
+  }
+
+  variable = &m_variables[slot];
+
+  // a command sequence is recorded once, and then referred to by its id
+  if (variable->isCommand && variable->commands) {
+    iter = m_traceSequenceIds.find(variable->commands.get());
+    if (iter == m_traceSequenceIds.end()) {
+      sequenceId = (int)m_traceSequences.size();
+      m_traceSequenceIds[variable->commands.get()] = sequenceId;
+      m_traceSequences.push_back(variable->commands);
+
+      writeTraceInt(m_traceStream, TRACE_RECORD_SEQUENCE);
+      writeTraceInt(m_traceStream, (long long)variable->commands->size());
+      for (int i = 0; i < (int)variable->commands->size(); i++) {
+        writeTraceInstruction(m_traceStream, (*variable->commands)[i]);
+      }
+    }
+    else {
+      sequenceId = iter->second;
+    }
+  }
+
+  writeTraceInt(m_traceStream, TRACE_RECORD_VARIABLE);
+  writeTraceInt(m_traceStream, slot);
+  writeTraceInt(m_traceStream, variable->isDefined);
+  writeTraceInt(m_traceStream, variable->isCommand);
+  writeTraceValue(m_traceStream, variable->value);
+  writeTraceInt(m_traceStream, variable->element);
+  writeTraceInt(m_traceStream, sequenceId);
+}
+void ProgramExecutor::traceOutput(const string& value) {
+  if (!m_traceWriter.is_open()) {
+    return;
+  }
+
+  writeTraceInt(m_traceStream, TRACE_RECORD_OUTPUT);
+  writeTraceString(m_traceStream, value);
+}
+void ProgramExecutor::traceEnd() {
+  if (!m_traceWriter.is_open()) {
+    return;
+  }
+
+  writeTraceInt(m_traceStream, TRACE_RECORD_END);
+  writeTraceInt(m_traceStream, m_executionCounter);
+  writeTraceInt(m_traceStream, m_bureaucrat - m_traceBureaucrat);
+  writeTraceInt(m_traceStream, m_delegate - m_traceDelegate);
+}
+void ProgramExecutor::hashRung(const int index) {
+  if (m_cycleDetector) {
+    m_cycleDetector->updateRung(*this, index);
+  }
+}
+void ProgramExecutor::hashVariable(const int slot) {
+  if (m_cycleDetector) {
+    m_cycleDetector->updateVariable(*this, slot);
+  }
+}
+
+void ProgramExecutor::outputRung(const Instruction& instruction, std::ostream& output, const string& indent) {
+  map<string, int>::iterator iter;
+  const Rung* rung = &m_rungs[instruction.rung];
+
+  if (rung->lineNumber == INPUT_LINE_NUMBER) {
+    output << "(INPUT, " << rung->columnNumber << ") ";
+  }
+  else {
+    output << "(" << rung->lineNumber << ", " << rung->columnNumber << ") ";
+  }
+  output << "\"" << rung->name << "\" ";
+  output << rungTypeToString(opcodeToRungType(instruction.opcode)) << " ";
+  switch (opcodeToRungType(instruction.opcode)) {
+  case RUNG_TYPE_COMMAND:
+    output << rungCommandToString(instruction.opcode) << " ";
+    break;
+  case RUNG_TYPE_VARIABLE:
+    iter = m_variableSlots.find(rung->name);
+    if (iter == m_variableSlots.end() || !m_variables[iter->second].isDefined) {
+      output << "UNINITIALIZED";
+    }
+    else if (m_variables[iter->second].isCommand) {
+      output << "COMMAND";
+    }
+    else {
+      output << "VALUE";
+    }
+    output << "_VARIABLE ";
+    break;
+  case RUNG_TYPE_LITERAL:
+    output << instruction.value << " ";
+    break;
+  case RUNG_TYPE_PUNCTUATION:
+    output << instruction.value << " ";
+    break;
+  default:
+    break;
+  }
+  output << toElementString(instruction.element);
+}
+
+void ProgramExecutor::outputProgram(ostream& output) {
+  for (int i = (int)m_program.size()-1; i >= 0; i--) {
+    // indicates position of delegate
+    if (i == m_delegate) {
+      output << "D>";
+    }
+    else {
+      output << "  ";
+    }
+
+    // indicates position of bureaucrat
+    if (i == m_bureaucrat) {
+      output << "B>";
+    }
+    else {
+      output << "  ";
+    }
+
+    output << i << ": ";
+
+    outputRung(m_program[i], output);
+    output << endl;
+  }
+}
+
+void ProgramExecutor::outputVariable(const Variable& variable, ostream& output, const int index_command) {
+  const vector<Instruction>* variableCommands;
+
+  if(variable.isCommand){
+    output << "COMMAND_VARIABLE ";
+    output << variable.value << " ";
+    output << toElementString(variable.element);
+    variableCommands = variable.commands.get();
+    for (int i = (int)variableCommands->size() - 1; i >= 0; i--) {
+      output << endl;
+
+      // indicates position of indexed command
+      if (i == index_command) {
+        output << "  ->" << i << ": ";
+      }
+      else {
+        output << "    " << i << ": ";
+      }
+
+      outputRung((*variableCommands)[i], output);
+    }
+  }
+  else {
+    output << "VALUE_VARIABLE ";
+    output << variable.value << " ";
+    output << toElementString(variable.element);
+  }
+}
+
+void ProgramExecutor::outputVariables(ostream& output, const int command_variable, const int index_command) {
+  map<string, int>::iterator iter;
+
+  // variables are listed by name
+  for (iter = m_variableSlots.begin(); iter != m_variableSlots.end(); iter++) {
+    if (!m_variables[iter->second].isDefined) {
+      continue;
+    }
+
+    output << "  " << iter->first << ": ";
+    if (iter->second == command_variable) {
+      outputVariable(m_variables[iter->second], output, index_command);
+    }
+    else {
+      outputVariable(m_variables[iter->second], output);
+    }
+
+    output << endl;
+  }
 }
\ No newline at end of file
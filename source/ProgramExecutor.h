@@ -1,183 +1,632 @@
-#ifndef PROGRAM_EXECUTOR_H
-#define PROGRAM_EXECUTOR_H
-
-#define $PE ProgramExecutor
-
-#include "elements.h"
-#include "TokenGenerator.h"
-
-#include <string>
-#include <vector>
-#include <map>
-#include <cstdlib>
-#include <sstream>
-#include <fstream>
-
-#define RAND_MAX_SOME 50
-#define RAND_MAX_MANY 1000
-
-#define INPUT_LINE_NUMBER -2
-
-#define YIN 0
-#define YANG 1
-
-#define RUNG_TYPE_UNDEFINED 0
-#define RUNG_TYPE_COMMAND 1
-#define RUNG_TYPE_VARIABLE 2
-#define RUNG_TYPE_LITERAL 3
-#define RUNG_TYPE_PUNCTUATION 4
-
-#define RUNG_LINE_NUMBER_DEFAULT -1
-#define RUNG_COLUMN_NUMBER_DEFAULT -1
-#define RUNG_NAME_DEFAULT ""
-#define RUNG_TYPE_DEFAULT RUNG_TYPE_UNDEFINED
-#define RUNG_VALUE_DEFAULT 0.0
-#define RUNG_COMMAND_VALUE_DEFAULT -1.0
-#define RUNG_ELEMENT_DEFAULT ELEM_EARTH
-
-#define DUMP_NO_EXECUTIONS 0
-#define DUMP_NON_VARIABLE_EXECUTIONS 1
-#define DUMP_ALL_EXECUTIONS 2
-
-#define EXECUTION_DUMP_FILE_STRING "__Haifu_execution_log.txt"
-#define OUTPUT_LINE_STRING "-------------------------------------------------------------"
-
-std::string rungTypeToString(const char rungType);
-std::string rungCommandToString(const double rungType);
-
-struct Rung {
-  int lineNumber;
-  int columnNumber;
-  std::string name;
-  char type;
-  double value;
-  char element;
-
-  Rung(
-    int i_lineNumber = RUNG_LINE_NUMBER_DEFAULT
-    , int i_columnNumber = RUNG_COLUMN_NUMBER_DEFAULT
-    , std::string i_name = RUNG_NAME_DEFAULT
-    , char i_type = RUNG_TYPE_DEFAULT
-    , double i_value = RUNG_VALUE_DEFAULT
-    , char i_element = RUNG_ELEMENT_DEFAULT
-    )
-  {
-    lineNumber = i_lineNumber;
-    columnNumber = i_columnNumber;
-    name = i_name;
-    type = i_type;
-    value = i_value;
-    element = i_element;
-  }
-};
-
-const Rung RUNG_NULL = Rung();
-
-struct Variable {
-  bool isCommand;
-  double value;
-  char element;
-  std::vector<Rung> commands;
-
-  Variable(
-    bool i_isCommand = false
-    , double i_value = 0.0
-    , char i_element = ELEM_NONE
-    , const std::vector<Rung>& i_commands = {}
-    )
-  {
-    isCommand = i_isCommand;
-    value = i_value;
-    element = i_element;
-    commands = i_commands;
-  }
-};
-
-class ProgramExecutor {
-public:
-  static void loadProgram(const std::vector<HaifuToken>& tokens);
-
-  static void executeProgram(std::istream& input);
-
-  static int toggleExecutionDump();
-
-private:
-  typedef ProgramExecutor __this;
-
-  static std::vector<Rung> s_program;
-  static int s_bureaucrat;
-  static int s_delegate;
-
-  static int s_inputCounter;
-  static int s_executionCounter;
-
-  static bool s_wasBureaucratChanged;
-  static bool s_areExecutionsDumped;
-  static bool s_areVariableExecutionsDumped;
-
-  static std::map<std::string, Variable> s_variables;
-
-  static std::ofstream logFileStream;
-
-  static void output(const std::string& value);
-
-  static void appendRung_token(const HaifuToken& token);
-
-  static void insertRung(const Rung& rung, const int index);
-  static void removeRung(const int index);
-
-  static bool executeRung(const Rung& rung, std::istream& input, const std::string& command_variable = "", const int index_command = -1);
-  static bool executeRung_variable(const std::string& rungName, std::istream& input);
-  static bool executeRung_punctuation();
-  static bool executeRung_command(const Rung& rung, std::istream& input);
-
-  static bool isNumeric_store(const Rung& rung, double& value);
-  static bool isNumeric_store(const int programIndex, double& value);
-
-  static bool haveSameName(const Rung& rung0, const Rung& rung1);
-
-  static char yin_yang(const double value);
-
-  static double getCommandValue(const int commandCode);
-  static char getRungElement(const Rung& rung);
-
-  static Variable* getVariable(const std::string& rungName);
-  static Variable* getExistingVariable(const std::string& rungName);
-
-  static const std::string& getVariableName(const std::string& rungName);
-
-  static void assignRungValue(Rung& rung, const double value);
-
-  // checks if s_delegate+1 is out of range of s_program and crates an error
-  //  (should not happen if ProgramExecutor adheres to specifications)
-  static bool areOperatorsInRange();
-
-  // the various possible commands
-  //  return value of true indicates that execution should stop
-  static bool command_heaven();
-  static bool command_promote();
-  static bool command_demote();
-  static bool command_blossom();
-  static bool command_rise();
-  static bool command_fall();
-  static bool command_listen(std::istream& input);
-  static bool command_speak();
-  static bool command_count();
-  static bool command_create();
-  static bool command_destroy();
-  static bool command_fear();
-  static bool command_love();
-  static bool command_become();
-  static bool command_like();
-  static bool command_tomorrow();
-  static bool command_negative();
-  static bool command_operate();
-
-  static void outputRung(const Rung& rung, std::ostream& output, const std::string& indent = "");
-  static void outputProgram(std::ostream& output);
-
-  static void outputVariable(const Variable& variable, std::ostream& output, const int index_command = -1);
-  static void outputVariables(std::ostream& output, const std::string& command_variable = "", const int index_command = -1);
-};
-
+#ifndef PROGRAM_EXECUTOR_H
+#define PROGRAM_EXECUTOR_H
+
+#define $PE ProgramExecutor
+
+#include "elements.h"
+#include "TokenGenerator.h"
+#include "AsyncLogWriter.h"
+#include "OutputSink.h"
+#include "InputReader.h"
+#include "RandomGenerator.h"
+#include "RungValue.h"
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <map>
+#include <cstdlib>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <atomic>
+#include <chrono>
+
+#define RAND_MAX_SOME 50
+#define RAND_MAX_MANY 1000
+
+#define INPUT_LINE_NUMBER -2
+
+#define YIN 0
+#define YANG 1
+
+#define RUNG_TYPE_UNDEFINED 0
+#define RUNG_TYPE_COMMAND 1
+#define RUNG_TYPE_VARIABLE 2
+#define RUNG_TYPE_LITERAL 3
+#define RUNG_TYPE_PUNCTUATION 4
+
+#define RUNG_LINE_NUMBER_DEFAULT -1
+#define RUNG_COLUMN_NUMBER_DEFAULT -1
+#define RUNG_NAME_DEFAULT ""
+#define RUNG_TYPE_DEFAULT RUNG_TYPE_UNDEFINED
+#define RUNG_VALUE_DEFAULT 0.0
+#define RUNG_COMMAND_VALUE_DEFAULT -1.0
+#define RUNG_ELEMENT_DEFAULT ELEM_EARTH
+
+// opcodes of the compiled program
+//   (the opcode of a command is its reserved word code)
+#define OPCODE_UNDEFINED RESERVED_WORD_UNDEFINED
+#define OPCODE_LITERAL 21
+#define OPCODE_VARIABLE 22
+#define OPCODE_PUNCTUATION 23
+#define OPCODE_COUNT 24
+
+// handlers of superinstructions, which execute a rung together with the ones after it
+//   (the handler of any other rung is its opcode)
+#define HANDLER_LITERAL_RISE 24
+#define HANDLER_LITERAL_FALL 25
+#define HANDLER_LITERAL_LITERAL_RISE 26
+#define HANDLER_LITERAL_LITERAL_FALL 27
+#define HANDLER_VARIABLE_SPEAK 28
+// passes over a stretch of rungs without effect at once
+#define HANDLER_SKIP 29
+#define HANDLER_COUNT 30
+
+// the most rungs fused into a superinstruction
+#define SUPERINSTRUCTION_LENGTH_MAX 3
+
+// the most rungs without effect passed over at once
+#define SKIP_LENGTH_MAX 32
+
+// the program is dispatched with computed gotos when the compiler supports them
+//   (defining USE_SWITCH_DISPATCH selects the portable switch instead)
+#if defined(__GNUC__) && !defined(USE_SWITCH_DISPATCH)
+#define USE_THREADED_DISPATCH
+#endif
+// (defining USE_RUNG_DISPATCH executes every rung through executeRung, as dumps do,
+//  which is how the program was dispatched before either loop, and what the benchmark compares them with)
+
+#define INSTRUCTION_OPERAND_DEFAULT -1
+#define INSTRUCTION_RUNG_DEFAULT -1
+
+#define COMMAND_SEQUENCE_START_NONE -1
+
+#define DUMP_NO_EXECUTIONS 0
+#define DUMP_NON_VARIABLE_EXECUTIONS 1
+#define DUMP_ALL_EXECUTIONS 2
+
+// how an execution ended
+#define EXECUTION_STATUS_DONE 0
+#define EXECUTION_STATUS_STEP_BUDGET 1
+#define EXECUTION_STATUS_TIME_BUDGET 2
+#define EXECUTION_STATUS_CANCELLED 3
+#define EXECUTION_STATUS_BAD_CHECKPOINT 4
+// stopped once it repeated a state without reading input or writing output in between
+#define EXECUTION_STATUS_CYCLE 5
+#define EXECUTION_STATUS_MEMORY_BUDGET 6
+
+// a step, time or memory budget that is never exhausted
+#define EXECUTION_BUDGET_NONE 0
+
+// executions between checks of the time and memory budgets and of cancellation
+#define BUDGET_CHECK_INTERVAL 4096
+
+// the structures that hold the memory of an execution
+#define MEMORY_STRUCTURE_PROGRAM 0
+#define MEMORY_STRUCTURE_RUNGS 1
+#define MEMORY_STRUCTURE_VARIABLES 2
+#define MEMORY_STRUCTURE_COMMAND_SEQUENCES 3
+#define MEMORY_STRUCTURE_COMMAND_FRAMES 4
+#define MEMORY_STRUCTURE_COUNT 5
+
+// checkpoints are written only when requested
+#define CHECKPOINT_INTERVAL_NONE 0
+
+#define EXECUTION_DUMP_FILE_STRING "__Haifu_execution_log.txt"
+#define OUTPUT_LINE_STRING "-------------------------------------------------------------"
+
+std::string rungTypeToString(const char rungType);
+std::string rungCommandToString(const double rungType);
+
+std::string executionStatusToString(const int status);
+
+std::string memoryStructureToString(const int structure);
+
+// returns the rung type that corresponds to the opcode
+char opcodeToRungType(const char opcode);
+
+struct Rung {
+  int lineNumber;
+  int columnNumber;
+  std::string name;
+  char type;
+  double value;
+  char element;
+  // the name of the variable of a variable rung
+  //   (the base word of its name, resolved when the rung is created)
+  std::string variableName;
+
+  Rung(
+    int i_lineNumber = RUNG_LINE_NUMBER_DEFAULT
+    , int i_columnNumber = RUNG_COLUMN_NUMBER_DEFAULT
+    , std::string i_name = RUNG_NAME_DEFAULT
+    , char i_type = RUNG_TYPE_DEFAULT
+    , double i_value = RUNG_VALUE_DEFAULT
+    , char i_element = RUNG_ELEMENT_DEFAULT
+    , std::string i_variableName = RUNG_NAME_DEFAULT
+    )
+  {
+    lineNumber = i_lineNumber;
+    columnNumber = i_columnNumber;
+    name = i_name;
+    type = i_type;
+    value = i_value;
+    element = i_element;
+    variableName = i_variableName;
+  }
+};
+
+const Rung RUNG_NULL = Rung();
+
+// a rung lowered for execution
+//   (the source of the rung is kept in the rung table at index rung)
+struct Instruction {
+  char opcode;
+  // the handler that the program is dispatched to, which may fuse the following rungs
+  char handler;
+  char element;
+  // the number of rungs without effect from this one, which the skip handler passes over
+  //   (0 if the rung has an effect or starts a superinstruction)
+  char skipLength;
+  int operand;
+  int rung;
+  RungValue value;
+
+  Instruction(
+    char i_opcode = OPCODE_UNDEFINED
+    , char i_element = RUNG_ELEMENT_DEFAULT
+    , int i_operand = INSTRUCTION_OPERAND_DEFAULT
+    , int i_rung = INSTRUCTION_RUNG_DEFAULT
+    , RungValue i_value = RungValue()
+    )
+  {
+    opcode = i_opcode;
+    handler = i_opcode;
+    element = i_element;
+    skipLength = 0;
+    operand = i_operand;
+    rung = i_rung;
+    value = i_value;
+  }
+};
+
+// a command sequence, shared between the variables that store it
+typedef std::shared_ptr<const std::vector<Instruction> > CommandSequence;
+
+// the command sequence last stored by a punctuation rung
+//   (reused until a rung from the punctuation to the end of the sequence is modified, inserted or removed)
+struct CommandSequenceCache {
+  CommandSequence commands;
+  // the index of the punctuation in the program, kept up to date as rungs are inserted and removed before it,
+  // or COMMAND_SEQUENCE_START_NONE if the sequence must be built again
+  int start;
+  // distance from the punctuation to the rung that ends the sequence
+  int length;
+
+  CommandSequenceCache() {
+    start = COMMAND_SEQUENCE_START_NONE;
+    length = 0;
+  }
+};
+
+struct Variable {
+  bool isCommand;
+  RungValue value;
+  char element;
+  CommandSequence commands;
+  // whether the variable has been initialized during execution
+  bool isDefined;
+
+  Variable(
+    bool i_isCommand = false
+    , RungValue i_value = RungValue()
+    , char i_element = ELEM_NONE
+    , const CommandSequence& i_commands = CommandSequence()
+    , bool i_isDefined = false
+    )
+  {
+    isCommand = i_isCommand;
+    value = i_value;
+    element = i_element;
+    commands = i_commands;
+    isDefined = i_isDefined;
+  }
+};
+
+// a command variable being executed, and the index of the rung of its sequence being executed
+//   (the sequence is held only so that it outlives a redefinition of the variable by the rung it is executing;
+//    after each rung the frame goes on with what its slot holds, and ends if the slot holds a value)
+struct CommandFrame {
+  CommandSequence commands;
+  int slot;
+  int index;
+
+  CommandFrame(const int i_slot, const CommandSequence& i_commands) {
+    commands = i_commands;
+    slot = i_slot;
+    index = 0;
+  }
+};
+
+// the bytes held by an execution, by the structure that holds them
+//   (estimated from the number of elements of each structure and the lengths of the names in the rung table,
+//    with each command sequence counted once however many variables and punctuation rungs hold it)
+struct MemoryUsage {
+  long long bytes[MEMORY_STRUCTURE_COUNT];
+
+  MemoryUsage() {
+    for (int i = 0; i < MEMORY_STRUCTURE_COUNT; i++) {
+      bytes[i] = 0;
+    }
+  }
+
+  long long getTotal() const {
+    long long total = 0;
+
+    for (int i = 0; i < MEMORY_STRUCTURE_COUNT; i++) {
+      total += bytes[i];
+    }
+
+    return total;
+  }
+};
+
+class ExecutionProfiler;
+class ExecutionCycleDetector;
+
+class ProgramExecutor {
+public:
+  // writes to the output stream through a sink of its own
+  ProgramExecutor(std::ostream& output = std::cout);
+  ProgramExecutor(OutputSink& sink);
+  ~ProgramExecutor();
+
+  // (the lines of the source, if given, are what profiled executions map their heat onto)
+  void load(const std::vector<HaifuToken>& tokens, const std::vector<std::string>& sourceLines = std::vector<std::string>());
+
+  // returns how the execution ended
+  int execute(std::istream& input);
+  int execute(InputReader& input);
+
+  // continues the execution saved in the checkpoint file, reading its input from where it had read to
+  //   (the program is the one in the checkpoint, replacing any that was loaded)
+  // returns how the execution ended, or EXECUTION_STATUS_BAD_CHECKPOINT if it cannot be resumed
+  int resume(const std::string& checkpointFilename, InputReader& input);
+
+  // limits the executions of a program, the seconds it may run and the bytes it may hold
+  //   (EXECUTION_BUDGET_NONE for no limit)
+  // the memory budget is checked with the time budget, so an execution may exceed it
+  // by what it adds in BUDGET_CHECK_INTERVAL executions
+  void setBudgets(const long long stepBudget, const double timeBudget = EXECUTION_BUDGET_NONE, const long long memoryBudget = EXECUTION_BUDGET_NONE);
+
+  // stops the execution in progress at its next budget check
+  //   (may be called from any thread)
+  void cancel();
+
+  // returns the number of rungs executed by the last execution
+  long long getExecutionCount() const;
+
+  // returns the most bytes the last execution was measured to hold
+  long long getPeakMemory() const;
+
+  // makes executions save themselves to the checkpoint file every interval executions
+  //   (CHECKPOINT_INTERVAL_NONE to save only when requested, and an empty filename for no checkpoints)
+  // a checkpoint is written between two rungs of the program, never within a command variable
+  void setCheckpoint(const std::string& filename, const long long interval = CHECKPOINT_INTERVAL_NONE);
+
+  // makes every execution generate the numbers of some and many from the seed
+  void setSeed(const unsigned long long seed);
+  // makes each execution choose a seed of its own (the default)
+  void clearSeed();
+  // returns the seed of the last execution
+  //   (the front end displays the seed of a program that uses some or many, so that the run can be repeated,
+  //    and the batch runner records it with each job; neither writes it into the output of the program)
+  unsigned long long getSeed() const;
+  // returns whether the loaded program uses some or many
+  bool isRandom() const;
+
+  int toggleDump();
+
+  // returns whether executions are now traced to the binary trace file
+  bool toggleTrace();
+
+  // returns whether the log and trace now block or drop when their writer falls behind
+  int toggleLogPolicy();
+
+  // returns whether executions are now profiled, with the profile written to its file when each execution ends
+  // and the heat map of the source written to its text and HTML files
+  //   (a profiled program executes rung by rung, as a dumped one does)
+  bool toggleProfile();
+
+  // returns whether executions now stop once they repeat a state without reading input or writing output,
+  // from which they would never end
+  //   (the state is checked between every two rungs of the program, which slows execution)
+  bool toggleCycleDetection();
+
+  // the static interface loads and executes programs with the default executor
+  static void loadProgram(const std::vector<HaifuToken>& tokens, const std::vector<std::string>& sourceLines = std::vector<std::string>());
+
+  static int executeProgram(std::istream& input);
+  static int executeProgram(InputReader& input);
+
+  static int resumeProgram(const std::string& checkpointFilename, InputReader& input);
+
+  static void setExecutionBudgets(const long long stepBudget, const double timeBudget = EXECUTION_BUDGET_NONE, const long long memoryBudget = EXECUTION_BUDGET_NONE);
+
+  static void setExecutionSeed(const unsigned long long seed);
+  static void clearExecutionSeed();
+  static bool isProgramRandom();
+  static unsigned long long getExecutionSeed();
+
+  static int toggleExecutionDump();
+
+  static bool toggleExecutionTrace();
+
+  static int toggleExecutionLogPolicy();
+
+  static bool toggleExecutionProfile();
+
+  static bool toggleExecutionCycleDetection();
+
+  static void setExecutionCheckpoint(const std::string& filename, const long long interval = CHECKPOINT_INTERVAL_NONE);
+
+  // makes the executions that write checkpoints write one at their next budget check
+  //   (may be called from any thread, or from a signal handler)
+  static void requestCheckpoint();
+
+private:
+  typedef ProgramExecutor __this;
+
+  friend class TraceReplayer;
+  friend class ExecutionCheckpoint;
+  friend class ExecutionCycleDetector;
+
+  static std::atomic<bool> s_isCheckpointRequested;
+
+  // returns the executor used by the static interface
+  static ProgramExecutor& getDefault();
+
+  // the sink created for an output stream, if the executor was not given one
+  std::unique_ptr<OutputSink> m_streamSink;
+  // where the output of the program and any warnings are written
+  //   (the sink is flushed when a program is loaded, before input is typed, and when execution ends)
+  OutputSink* m_sink;
+  std::ostream m_output;
+
+  // the source rungs of the program and of any input
+  std::vector<Rung> m_rungs;
+  // the lines of the source of the program, if it was loaded with them
+  std::vector<std::string> m_sourceLines;
+  // the program, starting from its last word
+  //   (a deque, since listen inserts at the front and the bureaucrat indexes at random)
+  std::deque<Instruction> m_program;
+  int m_bureaucrat;
+  int m_delegate;
+
+  int m_inputCounter;
+  long long m_executionCounter;
+
+  long long m_stepBudget;
+  double m_timeBudget;
+  long long m_memoryBudget;
+  std::chrono::steady_clock::time_point m_deadline;
+  // the execution at which the budgets are next checked
+  long long m_budgetCheckCounter;
+  std::atomic<bool> m_isCancelRequested;
+  int m_status;
+
+  // the numbers of some and many
+  RandomGenerator m_random;
+  unsigned long long m_seed;
+  bool m_isSeedFixed;
+  // whether the program has some or many in it
+  bool m_isRandom;
+
+  // where executions are saved, if they are
+  std::string m_checkpointFilename;
+  long long m_checkpointInterval;
+  // the execution at which the next checkpoint is written
+  long long m_nextCheckpoint;
+  // the input of the execution in progress, whose position is saved with it
+  InputReader* m_input;
+
+  bool m_wasBureaucratChanged;
+  // the command variables being executed, from the one the program executed to the one it executed last
+  //   (command variables that execute others are executed by a loop over these, not by recursion)
+  std::vector<CommandFrame> m_commandFrames;
+  bool m_areExecutionsDumped;
+  bool m_areVariableExecutionsDumped;
+
+  // the variables, indexed by slot (the operand of variable instructions)
+  std::vector<Variable> m_variables;
+  // the names of the variables, indexed by slot
+  std::vector<std::string> m_variableNames;
+  // the slots of the variables, by name (only used for loading and dumps)
+  std::map<std::string, int> m_variableSlots;
+
+  // the command sequences of the punctuation rungs (the operand of punctuation instructions)
+  std::vector<CommandSequenceCache> m_commandSequences;
+  // the punctuation operands of the command sequences that are built
+  std::vector<int> m_builtCommandSequences;
+
+  // the log and the trace are written by background writers
+  int m_logPolicy;
+  AsyncLogWriter m_logWriter;
+  std::ostream m_logFileStream;
+
+  // the binary trace, which records only what changes at each step
+  //   (open while a traced program executes)
+  bool m_isExecutionTraced;
+  AsyncLogWriter m_traceWriter;
+  std::ostream m_traceStream;
+  // the positions at the last recorded step
+  int m_traceBureaucrat;
+  int m_traceDelegate;
+  // the ids of the command sequences that have been recorded
+  //   (holding the sequences, so that their addresses are not reused)
+  std::map<const std::vector<Instruction>*, int> m_traceSequenceIds;
+  std::vector<CommandSequence> m_traceSequences;
+
+  // the profile of the execution, if executions are profiled
+  std::unique_ptr<ExecutionProfiler> m_profiler;
+
+  // the hash of the state of the execution, if cycles are detected
+  std::unique_ptr<ExecutionCycleDetector> m_cycleDetector;
+
+  // the bytes held by the rung table, kept up to date as listen adds to it
+  long long m_rungBytes;
+  // the memory of the execution when it started and when it was last measured, and the most it held
+  MemoryUsage m_memoryUsage_start;
+  MemoryUsage m_memoryUsage;
+  long long m_peakMemory;
+  // the execution at which the memory is next measured
+  long long m_memoryCheckCounter;
+  // (kept between measurements so that they do not allocate)
+  std::vector<const std::vector<Instruction>*> m_measuredSequences;
+
+  // sets the members that do not depend on where the output goes
+  void initialize();
+
+  void output(const std::string& value);
+
+  void appendRung_token(const HaifuToken& token);
+
+  // stores the rung in the rung table and returns its lowered instruction
+  Instruction compileRung(const Rung& rung);
+  // returns the slot of the variable, adding it if it is new
+  int getVariableSlot(const std::string& variableName);
+
+  void insertRung(const Instruction& instruction, const int index);
+  void removeRung(const int index);
+
+  // returns whether the rung does nothing when the bureaucrat executes it
+  static bool isWithoutEffect(const char opcode);
+  // returns the superinstruction that starts at the index, or the opcode of the rung if none does
+  char selectSuperinstruction(const int index);
+  // selects the handler of the rung at the index, fusing it with the rungs after it
+  // if they form a superinstruction or a stretch of rungs without effect
+  //   (the rung after it must already have its handler)
+  void selectHandler(const int index);
+  // selects the handlers of the whole program, from its end
+  void selectHandlers();
+  // reselects the handlers of the superinstructions and stretches that could contain the rung at the index
+  void updateHandlers(const int index);
+
+  // drops the built command sequences that the rung at the index is part of, after the rung is modified,
+  // and moves those after it by shift (1 after the rung is inserted and -1 after it is removed)
+  void invalidateCommandSequences(const int index, const int shift = 0);
+  void clearCommandSequences();
+
+  // executes the program from the bureaucrat, then writes what the execution logged and profiled
+  int run(InputReader& input);
+
+  // returns true if the execution must stop, setting its status
+  //   otherwise writes a checkpoint if one is due and the executor is between two rungs of the program,
+  //   and sets when the budgets are next checked
+  bool isOverBudget(const bool isBetweenRungs);
+
+  // saves the execution to the checkpoint file
+  void writeCheckpoint();
+
+  // returns the bytes the rung holds in the rung table
+  static long long getRungBytes(const Rung& rung);
+  // measures the memory of the execution into m_memoryUsage
+  void measureMemory();
+
+  // executes the program from the bureaucrat until it terminates
+  //   (without dumps, which go through executeRung)
+
+  void executeInstructions(InputReader& input);
+
+  bool executeRung(const Instruction& instruction, InputReader& input);
+  // checks the budgets, dumps, traces and counts a rung, of the program or of the command variable in the slot
+  //   returns true if a budget is exhausted
+  bool beginRung(const int command_variable = -1, const int index_command = -1);
+  void endRung(const Instruction& instruction, const bool isInVariable);
+  bool dispatchRung(const Instruction& instruction, InputReader& input);
+  bool executeRung_variable(const Instruction& instruction, InputReader& input);
+  // enters the command variable in the slot, measuring the memory at the next rung if the frames outgrow their storage
+  void pushCommandFrame(const int slot, const CommandSequence& commands);
+  // leaves the command frames above the depth, ending the variable rungs that entered them
+  void leaveCommandFrames(const int depth);
+  bool executeRung_punctuation();
+  void defineCommandVariable(const Instruction& rung_named, const CommandSequence& commands);
+
+  bool isNumeric_store(const Instruction& instruction, RungValue& value);
+  bool isNumeric_store(const int programIndex, RungValue& value);
+
+  bool haveSameName(const Instruction& instruction0, const Instruction& instruction1);
+
+  static char yin_yang(const RungValue& value);
+
+  RungValue getCommandValue(const int commandCode);
+  char getRungElement(const Instruction& instruction);
+
+  Variable* getVariable(const int slot);
+  Variable* getExistingVariable(const int slot);
+
+  // returns the name of the variable that the word refers to
+  //   (only used while loading, so that execution does not use the word data)
+  const std::string& getVariableName(const std::string& rungName);
+
+  void assignRungValue(const int programIndex, const RungValue& value);
+
+  // checks if m_delegate+1 is out of range of m_program and crates an error
+  //  (should not happen if ProgramExecutor adheres to specifications)
+  bool areOperatorsInRange();
+
+  // the various possible commands
+  //  return value of true indicates that execution should stop
+  bool command_heaven();
+  bool command_promote();
+  bool command_demote();
+  bool command_blossom();
+  bool command_rise();
+  bool command_fall();
+  bool riseDelegate(const RungValue& value);
+  bool fallDelegate(const RungValue& value);
+  bool command_listen(InputReader& input);
+  bool command_speak();
+  bool command_count();
+  bool command_create();
+  bool command_destroy();
+  bool command_fear();
+  bool command_love();
+  bool command_become();
+  bool command_like();
+  bool command_tomorrow();
+  bool command_negative();
+  bool command_operate();
+
+  // writes the program and variables before an execution, or at termination
+  void outputExecution(std::ostream& output, const int command_variable = -1, const int index_command = -1);
+  // writes the names of the command variables being executed, from the one executed last to the one the program executed
+  //   (or only the name of the command variable, if there are no frames)
+  void outputCommandFrames(std::ostream& output, const int command_variable);
+  void outputTermination(std::ostream& output);
+
+  // record the changes of the execution in the trace
+  void traceHeader();
+  void traceStep(const int command_variable, const int index_command);
+  void traceRung(const Rung& rung);
+  void traceInsert(const int index);
+  void traceRemove(const int index);
+  void traceSet(const int index);
+  void traceVariable(const int slot);
+  void traceOutput(const std::string& value);
+  void traceEnd();
+
+  // update the hash of the state after the rung at the index or the variable in the slot is changed
+  void hashRung(const int index);
+  void hashVariable(const int slot);
+
+  void outputRung(const Instruction& instruction, std::ostream& output, const std::string& indent = "");
+  void outputProgram(std::ostream& output);
+
+  void outputVariable(const Variable& variable, std::ostream& output, const int index_command = -1);
+  void outputVariables(std::ostream& output, const int command_variable = -1, const int index_command = -1);
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "RandomGenerator.h"
+
+#include <random>
+#include <chrono>
+#include <atomic>
+
+using namespace std;
+
+static unsigned long long rotateLeft(const unsigned long long value, const int numBits) {
+  return (value << numBits) | (value >> (64 - numBits));
+}
+
+// returns the next number of a splitmix64 sequence, which spreads a seed over the state
+static unsigned long long splitMix(unsigned long long& state) {
+  unsigned long long result;
+
+  state += 0x9E3779B97F4A7C15ULL;
+  result = state;
+  result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  result = (result ^ (result >> 27)) * 0x94D049BB133111EBULL;
+
+  return result ^ (result >> 31);
+}
+
+RandomGenerator::RandomGenerator(const unsigned long long seed) {
+  this->seed(seed);
+}
+
+void RandomGenerator::seed(const unsigned long long seed) {
+  unsigned long long state = seed;
+
+  // (splitmix64 never gives a state of all zeros, which xoshiro could not leave)
+  for (int i = 0; i < RANDOM_STATE_SIZE; i++) {
+    m_state[i] = splitMix(state);
+  }
+}
+
+unsigned long long RandomGenerator::next() {
+  unsigned long long result = rotateLeft(m_state[1] * 5, 7) * 9;
+  unsigned long long shifted = m_state[1] << 17;
+
+  m_state[2] ^= m_state[0];
+  m_state[3] ^= m_state[1];
+  m_state[1] ^= m_state[2];
+  m_state[0] ^= m_state[3];
+  m_state[2] ^= shifted;
+  m_state[3] = rotateLeft(m_state[3], 45);
+
+  return result;
+}
+
+unsigned int RandomGenerator::nextBelow(const unsigned int bound) {
+  // scales 32 random bits to the bound, rejecting the few products that would favor some numbers
+  unsigned long long product = (next() >> 32) * bound;
+  unsigned int threshold;
+
+  if ((unsigned int)product < bound) {
+    threshold = (0U - bound) % bound;
+    while ((unsigned int)product < threshold) {
+      product = (next() >> 32) * bound;
+    }
+  }
+
+  return (unsigned int)(product >> 32);
+}
+
+void RandomGenerator::getState(unsigned long long state[RANDOM_STATE_SIZE]) const {
+  for (int i = 0; i < RANDOM_STATE_SIZE; i++) {
+    state[i] = m_state[i];
+  }
+}
+
+void RandomGenerator::setState(const unsigned long long state[RANDOM_STATE_SIZE]) {
+  for (int i = 0; i < RANDOM_STATE_SIZE; i++) {
+    m_state[i] = state[i];
+  }
+}
+
+unsigned long long makeRandomSeed() {
+  // executors seeded at the same moment still get different seeds
+  static atomic<unsigned long long> s_counter(0);
+  random_device device;
+  unsigned long long state =
+    ((unsigned long long)device() << 32)
+    ^ (unsigned long long)device()
+    ^ (unsigned long long)chrono::steady_clock::now().time_since_epoch().count()
+    ^ (s_counter++ * 0x9E3779B97F4A7C15ULL);
+
+  return splitMix(state);
+}
\ No newline at end of file
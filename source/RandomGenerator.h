@@ -0,0 +1,36 @@
+#ifndef RANDOM_GENERATOR_H
+#define RANDOM_GENERATOR_H
+
+// the words of the state of a generator
+#define RANDOM_STATE_SIZE 4
+
+// a xoshiro256** generator
+//   each executor owns one, so that executors never share random state,
+//   and the numbers it generates depend only on its seed
+class RandomGenerator {
+public:
+  RandomGenerator(const unsigned long long seed = 0);
+
+  // restarts the sequence of numbers from the seed
+  void seed(const unsigned long long seed);
+
+  unsigned long long next();
+
+  // returns a number from 0 to bound - 1, each as likely as the others
+  //   (bound must be positive)
+  unsigned int nextBelow(const unsigned int bound);
+
+  // the state, so that a generator can be saved and restored where it left off
+  void getState(unsigned long long state[RANDOM_STATE_SIZE]) const;
+  void setState(const unsigned long long state[RANDOM_STATE_SIZE]);
+
+private:
+  typedef RandomGenerator __this;
+
+  unsigned long long m_state[RANDOM_STATE_SIZE];
+};
+
+// returns a seed that differs from run to run
+unsigned long long makeRandomSeed();
+
+#endif
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include "RungValue.h"
+#include "OutputSink.h"
+#include "funcs.h"
+
+#include <cmath>
+#include <charconv>
+
+using namespace std;
+
+// integers below this are written in full by the general format with 6 significant digits
+#define FORMAT_INTEGER_MAX 1000000
+
+RungValue::RungValue(const double value) {
+  long long integer;
+
+  m_isInteger = false;
+  m_real = value;
+
+  // (NaN fails the comparisons)
+  if (value >= -(double)RUNG_VALUE_INTEGER_MAX && value <= (double)RUNG_VALUE_INTEGER_MAX) {
+    integer = (long long)value;
+    if ((double)integer == value && (integer != 0 || !signbit(value))) {
+      m_isInteger = true;
+      m_integer = integer;
+    }
+  }
+}
+
+int RungValue::toInt_rounded_real() const {
+  const double value = round_away(m_real);
+
+  // (NaN fails the comparisons)
+  return value >= (double)INT_MIN && value <= (double)INT_MAX ? (int)value : INT_MIN;
+}
+
+RungValue RungValue::operator-() const {
+  // (the negative of 0 is -0, which only a double can be)
+  if (m_isInteger && m_integer != 0) {
+    return RungValue(-m_integer);
+  }
+
+  return RungValue(-toDouble());
+}
+
+RungValue RungValue::operator+(const RungValue& value) const {
+  long long sum;
+
+  if (m_isInteger && value.m_isInteger) {
+    sum = m_integer + value.m_integer;
+    if (sum >= -RUNG_VALUE_INTEGER_MAX && sum <= RUNG_VALUE_INTEGER_MAX) {
+      return RungValue(sum);
+    }
+  }
+
+  return RungValue(toDouble() + value.toDouble());
+}
+
+RungValue RungValue::operator-(const RungValue& value) const {
+  long long difference;
+
+  if (m_isInteger && value.m_isInteger) {
+    difference = m_integer - value.m_integer;
+    if (difference >= -RUNG_VALUE_INTEGER_MAX && difference <= RUNG_VALUE_INTEGER_MAX) {
+      return RungValue(difference);
+    }
+  }
+
+  return RungValue(toDouble() - value.toDouble());
+}
+
+RungValue RungValue::operator*(const RungValue& value) const {
+  double product;
+
+  // (a product of two integers is exact as a double while it is at most RUNG_VALUE_INTEGER_MAX,
+  //  which the constructor checks, and 0 times a negative is -0)
+  if (m_isInteger && value.m_isInteger) {
+    product = (double)m_integer * (double)value.m_integer;
+    if (product != 0.0 && product >= -(double)RUNG_VALUE_INTEGER_MAX && product <= (double)RUNG_VALUE_INTEGER_MAX) {
+      return RungValue((long long)product);
+    }
+    return RungValue(product);
+  }
+
+  return RungValue(toDouble() * value.toDouble());
+}
+
+RungValue RungValue::operator/(const RungValue& value) const {
+  // an integer divided by one of its divisors stays an integer (0 divided by a negative is -0)
+  if (m_isInteger && value.m_isInteger
+    && value.m_integer != 0
+    && m_integer % value.m_integer == 0
+    && (m_integer != 0 || value.m_integer > 0)
+    )
+  {
+    return RungValue(m_integer / value.m_integer);
+  }
+
+  return RungValue(toDouble() / value.toDouble());
+}
+
+bool RungValue::operator==(const RungValue& value) const {
+  if (m_isInteger && value.m_isInteger) {
+    return m_integer == value.m_integer;
+  }
+
+  return toDouble() == value.toDouble();
+}
+
+ostream& operator<<(ostream& output, const RungValue& value) {
+  return output << value.toDouble();
+}
+
+int formatNumber(const RungValue& value, char* buffer) {
+  to_chars_result result;
+
+  if (value.isInteger() && value.getInteger() > -FORMAT_INTEGER_MAX && value.getInteger() < FORMAT_INTEGER_MAX) {
+    result = to_chars(buffer, buffer + NUMBER_STRING_LENGTH_MAX, value.getInteger());
+    return (int)(result.ptr - buffer);
+  }
+
+  return formatNumber(value.toDouble(), buffer);
+}
\ No newline at end of file
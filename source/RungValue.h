@@ -0,0 +1,85 @@
+#ifndef RUNG_VALUE_H
+#define RUNG_VALUE_H
+
+#include <iostream>
+#include <climits>
+
+// the largest integer up to which every integer is exactly a double
+#define RUNG_VALUE_INTEGER_MAX (1LL << 53)
+
+// the value of a literal or a variable while a program executes
+//   nearly every value is a small integer, so integers are kept as integers
+//   and only become doubles when operate divides or listen reads a fraction
+//   (a value is an integer exactly when the double it stands for is an integer of at most RUNG_VALUE_INTEGER_MAX
+//    other than -0, so it always behaves, compares and prints as that double would)
+class RungValue {
+public:
+  RungValue() {
+    m_isInteger = true;
+    m_integer = 0;
+  }
+  RungValue(const int value) {
+    m_isInteger = true;
+    m_integer = value;
+  }
+  // (value must be at most RUNG_VALUE_INTEGER_MAX)
+  RungValue(const long long value) {
+    m_isInteger = true;
+    m_integer = value;
+  }
+  RungValue(const double value);
+
+  bool isInteger() const {
+    return m_isInteger;
+  }
+  long long getInteger() const {
+    return m_integer;
+  }
+  double toDouble() const {
+    return m_isInteger ? (double)m_integer : m_real;
+  }
+
+  bool isZero() const {
+    return m_isInteger ? m_integer == 0 : m_real == 0.0;
+  }
+  bool isNegative() const {
+    return m_isInteger ? m_integer < 0 : m_real < 0.0;
+  }
+
+  // returns the value rounded away from 0, as the int that moves the bureaucrat and delegate
+  //   (a value outside the range of int, or NaN, is INT_MIN, as the conversion of a double gives on x86)
+  int toInt_rounded() const {
+    if (m_isInteger) {
+      return m_integer >= INT_MIN && m_integer <= INT_MAX ? (int)m_integer : INT_MIN;
+    }
+    return toInt_rounded_real();
+  }
+
+  RungValue operator-() const;
+  RungValue operator+(const RungValue& value) const;
+  RungValue operator-(const RungValue& value) const;
+  RungValue operator*(const RungValue& value) const;
+  RungValue operator/(const RungValue& value) const;
+
+  bool operator==(const RungValue& value) const;
+
+private:
+  typedef RungValue __this;
+
+  bool m_isInteger;
+  union {
+    long long m_integer;
+    double m_real;
+  };
+
+  int toInt_rounded_real() const;
+};
+
+// writes the value as its double
+std::ostream& operator<<(std::ostream& output, const RungValue& value);
+
+// writes the value as formatNumber writes its double
+//   returns the number of characters written
+int formatNumber(const RungValue& value, char* buffer);
+
+#endif
\ No newline at end of file
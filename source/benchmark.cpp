@@ -0,0 +1,225 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+#include "WordData.h"
+#include "SyllableParser.h"
+#include "TokenGenerator.h"
+#include "ProgramExecutor.h"
+#include "funcs.h"
+
+// file that stores the persistent data
+#define PERSISTENT_DATA_FILENAME "__persistent_data.txt"
+
+// directory of the example programs, relative to the source directory
+#define PROGRAMS_DIRECTORY "../programs/"
+
+// input stream given to the example programs
+#define BENCHMARK_INPUT_STRING "42 7 hi"
+
+#define BENCHMARK_REPETITIONS_DEFAULT 5
+
+// number of iterations of the synthetic programs
+#define COUNTDOWN_ITERATIONS 300000
+#define REDEFINITION_ITERATIONS 100000
+
+// a stream buffer that discards the program output
+class NullBuffer : public streambuf {
+protected:
+  int overflow(int c) {
+    return c;
+  }
+};
+
+// tokens of a synthetic program, listed in execution order
+class SyntheticProgram {
+public:
+  SyntheticProgram& literal(const int value) {
+    tokens.push_back(HaifuToken(0, (int)tokens.size(), to_string(value), TOKEN_TYPE_NUMBER, value, ELEM_EARTH));
+    return *this;
+  }
+  SyntheticProgram& variable(const string& name, const char element) {
+    tokens.push_back(HaifuToken(0, (int)tokens.size(), name, TOKEN_TYPE_VARIABLE, 0, element));
+    return *this;
+  }
+  SyntheticProgram& punctuation() {
+    tokens.push_back(HaifuToken(0, (int)tokens.size(), ",", TOKEN_TYPE_PUNCTUATION, 0, ELEM_EARTH));
+    return *this;
+  }
+  SyntheticProgram& command(const string& name, const int code) {
+    tokens.push_back(HaifuToken(0, (int)tokens.size(), name, TOKEN_TYPE_RESERVED_WORD, code, ELEM_EARTH));
+    return *this;
+  }
+
+  // returns the tokens in the order of the words of a program
+  //   (the bureaucrat starts at the last word)
+  vector<HaifuToken> getTokens() const {
+    vector<HaifuToken> programTokens = tokens;
+    reverse(programTokens.begin(), programTokens.end());
+    return programTokens;
+  }
+
+private:
+  vector<HaifuToken> tokens;
+};
+
+// returns a program that speaks a countdown from iterations
+vector<HaifuToken> makeCountdownProgram(const int iterations);
+
+// returns a countdown that also redefines a command variable on every iteration
+vector<HaifuToken> makeRedefinitionProgram(const int iterations);
+
+// returns the tokens of the file, or an empty vector if it cannot be executed
+vector<HaifuToken> loadFileTokens(const string& filename);
+
+// executes the program repeatedly and displays the average time of an execution
+void benchmark(const string& name, const vector<HaifuToken>& tokens, const int repetitions);
+
+//-------------------------------------------------------------------------------
+// main()
+//-------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+  const char* examples[] = { "echo_letter.txt", "echo_letters10.txt", "echo_letters31.txt", "echo_number.txt" };
+  int repetitions = BENCHMARK_REPETITIONS_DEFAULT;
+
+  if (argc > 1) {
+    repetitions = max(1, atoi(argv[1]));
+  }
+
+  cout << endl;
+  $WD::loadData_TXT(PERSISTENT_DATA_FILENAME);
+
+  cout << endl;
+  // (the rung dispatch is the reference, executing each rung through executeRung as the interpreter did
+  //  before the threaded loop, and the switch is the portable fallback of the threaded loop)
+#if defined(USE_RUNG_DISPATCH)
+  cout << "Dispatch: RUNG (reference)" << endl;
+#elif defined(USE_THREADED_DISPATCH)
+  cout << "Dispatch: THREADED" << endl;
+#else
+  cout << "Dispatch: SWITCH (fallback)" << endl;
+#endif
+  cout << "Repetitions: " << repetitions << endl;
+  cout << endl;
+
+  for (int i = 0; i < (int)(sizeof(examples) / sizeof(examples[0])); i++) {
+    benchmark(examples[i], loadFileTokens(string(PROGRAMS_DIRECTORY) + examples[i]), repetitions);
+  }
+
+  benchmark("countdown", makeCountdownProgram(COUNTDOWN_ITERATIONS), repetitions);
+  benchmark("redefinition", makeRedefinitionProgram(REDEFINITION_ITERATIONS), repetitions);
+
+  return 0;
+}
+
+//-------------------------------------------------------------------------------
+// makeCountdownProgram()
+//-------------------------------------------------------------------------------
+vector<HaifuToken> makeCountdownProgram(const int iterations) {
+  SyntheticProgram program;
+
+  program.literal(iterations)
+    .variable("x", ELEM_FIRE).command("like", RESERVED_WORD_LIKE)
+    .variable("x", ELEM_FIRE).command("like", RESERVED_WORD_LIKE)
+    .literal(15).literal(10).literal(5).command("rise", RESERVED_WORD_RISE)
+    .variable("x", ELEM_FIRE)
+    .literal(-2).literal(4).command("rise", RESERVED_WORD_RISE)
+    .command("count", RESERVED_WORD_COUNT)
+    .literal(3).command("fall", RESERVED_WORD_FALL)
+    .command("speak", RESERVED_WORD_SPEAK)
+    .literal(3).command("rise", RESERVED_WORD_RISE)
+    .command("operate", RESERVED_WORD_OPERATE)
+    .command("become", RESERVED_WORD_BECOME)
+    .command("love", RESERVED_WORD_LOVE)
+    .literal(4).command("fall", RESERVED_WORD_FALL)
+    .command("demote", RESERVED_WORD_DEMOTE);
+
+  return program.getTokens();
+}
+
+//-------------------------------------------------------------------------------
+// makeRedefinitionProgram()
+//-------------------------------------------------------------------------------
+vector<HaifuToken> makeRedefinitionProgram(const int iterations) {
+  SyntheticProgram program;
+
+  program.literal(iterations)
+    .variable("x", ELEM_FIRE).command("like", RESERVED_WORD_LIKE)
+    .variable("x", ELEM_FIRE).command("like", RESERVED_WORD_LIKE)
+    .literal(19).literal(10).literal(5).command("rise", RESERVED_WORD_RISE)
+    .variable("x", ELEM_FIRE)
+    .literal(-2).literal(4).command("rise", RESERVED_WORD_RISE)
+    .punctuation()
+    .variable("f", ELEM_WOOD).command("count", RESERVED_WORD_COUNT).variable("f", ELEM_WOOD)
+    .variable("f", ELEM_WOOD)
+    .literal(3).command("fall", RESERVED_WORD_FALL)
+    .command("speak", RESERVED_WORD_SPEAK)
+    .literal(3).command("rise", RESERVED_WORD_RISE)
+    .command("operate", RESERVED_WORD_OPERATE)
+    .command("become", RESERVED_WORD_BECOME)
+    .command("love", RESERVED_WORD_LOVE)
+    .literal(4).command("fall", RESERVED_WORD_FALL)
+    .command("demote", RESERVED_WORD_DEMOTE);
+
+  return program.getTokens();
+}
+
+//-------------------------------------------------------------------------------
+// loadFileTokens()
+//-------------------------------------------------------------------------------
+vector<HaifuToken> loadFileTokens(const string& filename) {
+  NullBuffer output_null;
+  streambuf* output_buffer;
+  vector<HaifuToken> tokens;
+
+  // checks the file without displaying its contents
+  output_buffer = cout.rdbuf(&output_null);
+  if ($SP::checkFileForm(filename)) {
+    $TG::generateFileTokens($SP::getFileData());
+    tokens = $TG::getTokens();
+  }
+  cout.rdbuf(output_buffer);
+
+  if (tokens.empty()) {
+    cout << "Warning: \"" << filename << "\" could not be loaded" << endl;
+  }
+
+  return tokens;
+}
+
+//-------------------------------------------------------------------------------
+// benchmark()
+//-------------------------------------------------------------------------------
+void benchmark(const string& name, const vector<HaifuToken>& tokens, const int repetitions) {
+  NullBuffer output_null;
+  streambuf* output_buffer;
+  chrono::steady_clock::duration elapsed = chrono::steady_clock::duration::zero();
+  chrono::steady_clock::time_point start;
+
+  if (tokens.empty()) {
+    return;
+  }
+
+  output_buffer = cout.rdbuf(&output_null);
+  for (int i = 0; i < repetitions; i++) {
+    stringstream input(BENCHMARK_INPUT_STRING);
+
+    // the program modifies itself, so it is reloaded for each repetition
+    $PE::loadProgram(tokens);
+
+    start = chrono::steady_clock::now();
+    $PE::executeProgram(input);
+    elapsed += chrono::steady_clock::now() - start;
+  }
+  cout.rdbuf(output_buffer);
+
+  cout << name << ": "
+    << chrono::duration_cast<chrono::microseconds>(elapsed).count() / repetitions
+    << " us" << endl;
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+using namespace std;
+
+#include "ProgramExecutor.h"
+
+// number of generated programs, and the seed of the first
+#define DISPATCH_TEST_PROGRAM_COUNT 2000
+#define DISPATCH_TEST_SEED 1
+
+// the budget of the execution every smaller budget is compared with
+#define DISPATCH_TEST_STEP_BUDGET_FULL 20000
+// the most budgets checked for each program
+#define DISPATCH_TEST_STEP_BUDGET_MAX 64
+
+// input stream given to the generated programs
+#define DISPATCH_TEST_INPUT_STRING "5 7 hello 3 -2 abc 9"
+
+// the most failures displayed
+#define DISPATCH_TEST_FAILURE_COUNT_MAX 10
+
+// the result of executing a program
+struct DispatchResult {
+  int status;
+  long long executionCount;
+};
+
+// returns a program of literals, variables, punctuation and commands
+//   (literals are often followed by rise and fall, and variables by speak, which are fused into superinstructions)
+vector<HaifuToken> makeProgram(const unsigned int seed);
+
+// executes the program with the step budget
+DispatchResult execute(const vector<HaifuToken>& tokens, const unsigned int seed, const long long stepBudget);
+
+//-------------------------------------------------------------------------------
+// main()
+//-------------------------------------------------------------------------------
+// checks that every dispatch loop stops exactly at the step budget:
+// a program stopped by a budget smaller than its full execution has executed exactly that many steps,
+// and one with a larger budget ends as it did in full
+//   (built once for each dispatch loop by the test target)
+int main() {
+  vector<HaifuToken> tokens;
+  DispatchResult full;
+  DispatchResult result;
+  long long stepBudgetMax;
+  int numFailures = 0;
+  int numExecutions = 0;
+
+#if defined(USE_RUNG_DISPATCH)
+  cout << "Dispatch: RUNG" << endl;
+#elif defined(USE_THREADED_DISPATCH)
+  cout << "Dispatch: THREADED" << endl;
+#else
+  cout << "Dispatch: SWITCH" << endl;
+#endif
+
+  for (unsigned int seed = DISPATCH_TEST_SEED; seed < DISPATCH_TEST_SEED + DISPATCH_TEST_PROGRAM_COUNT; seed++) {
+    tokens = makeProgram(seed);
+    full = execute(tokens, seed, DISPATCH_TEST_STEP_BUDGET_FULL);
+
+    stepBudgetMax = min(full.executionCount + 1, (long long)DISPATCH_TEST_STEP_BUDGET_MAX);
+    for (long long stepBudget = 1; stepBudget <= stepBudgetMax; stepBudget++) {
+      bool isExpected;
+
+      result = execute(tokens, seed, stepBudget);
+      numExecutions++;
+
+      if (stepBudget < full.executionCount) {
+        isExpected = result.status == EXECUTION_STATUS_STEP_BUDGET && result.executionCount == stepBudget;
+      }
+      else {
+        isExpected = result.status == full.status && result.executionCount == full.executionCount;
+      }
+
+      if (!isExpected && numFailures++ < DISPATCH_TEST_FAILURE_COUNT_MAX) {
+        cout << "Error: program " << seed << " with a budget of " << stepBudget << " steps"
+          << " stopped by " << executionStatusToString(result.status) << " after " << result.executionCount << " executions"
+          << " (" << executionStatusToString(full.status) << " after " << full.executionCount << " in full)" << endl;
+      }
+    }
+  }
+
+  cout << "Executions checked: " << numExecutions << endl;
+  cout << "Failures: " << numFailures << endl;
+
+  return numFailures == 0 ? 0 : 1;
+}
+
+//-------------------------------------------------------------------------------
+// makeProgram()
+//-------------------------------------------------------------------------------
+vector<HaifuToken> makeProgram(const unsigned int seed) {
+  const char elements[] = { ELEM_EARTH, ELEM_METAL, ELEM_WATER, ELEM_WOOD, ELEM_FIRE };
+  mt19937 random(seed);
+  vector<HaifuToken> tokens;
+  const int length = 5 + (int)(random() % 60);
+  int kind;
+  int value;
+
+  for (int i = 0; i < length; i++) {
+    kind = (int)(random() % 10);
+
+    if (kind < 3) {
+      value = (int)(random() % 9) - 3;
+      tokens.push_back(HaifuToken(0, i, to_string(value), TOKEN_TYPE_NUMBER, value, ELEM_EARTH));
+      // (the program starts from its last word, so a command after a literal is executed before it)
+      if (random() % 2) {
+        tokens.push_back(HaifuToken(0, i, "rise", TOKEN_TYPE_RESERVED_WORD, random() % 2 ? RESERVED_WORD_RISE : RESERVED_WORD_FALL, ELEM_EARTH));
+      }
+    }
+    else if (kind < 5) {
+      tokens.push_back(HaifuToken(0, i, "speak", TOKEN_TYPE_RESERVED_WORD, RESERVED_WORD_SPEAK, ELEM_EARTH));
+      tokens.push_back(HaifuToken(0, i, string(1, (char)('a' + random() % 3)), TOKEN_TYPE_VARIABLE, 0, elements[random() % 5]));
+    }
+    else if (kind < 6) {
+      tokens.push_back(HaifuToken(0, i, ",", TOKEN_TYPE_PUNCTUATION, 0, ELEM_EARTH));
+    }
+    else if (kind < 7) {
+      tokens.push_back(HaifuToken(0, i, "some", TOKEN_TYPE_RESERVED_WORD, random() % 2 ? RESERVED_WORD_SOME : RESERVED_WORD_TOMORROW, ELEM_EARTH));
+    }
+    else {
+      // any command from heaven to operate
+      tokens.push_back(HaifuToken(0, i, "command", TOKEN_TYPE_RESERVED_WORD, RESERVED_WORD_HEAVEN + (int)(random() % (RESERVED_WORD_OPERATE - RESERVED_WORD_HEAVEN + 1)), ELEM_EARTH));
+    }
+  }
+
+  return tokens;
+}
+
+//-------------------------------------------------------------------------------
+// execute()
+//-------------------------------------------------------------------------------
+DispatchResult execute(const vector<HaifuToken>& tokens, const unsigned int seed, const long long stepBudget) {
+  MemorySink output;
+  ProgramExecutor executor(output);
+  stringstream input(DISPATCH_TEST_INPUT_STRING);
+  DispatchResult result;
+
+  executor.setSeed(seed);
+  executor.setBudgets(stepBudget);
+  executor.load(tokens);
+
+  result.status = executor.execute(input);
+  result.executionCount = executor.getExecutionCount();
+
+  return result;
+}
\ No newline at end of file
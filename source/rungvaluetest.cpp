@@ -0,0 +1,64 @@
+#include <iostream>
+#include <climits>
+
+using namespace std;
+
+#include "RungValue.h"
+
+// a value and the int it is rounded to
+struct RoundingCase {
+  RungValue value;
+  int expected;
+};
+
+//-------------------------------------------------------------------------------
+// main()
+//-------------------------------------------------------------------------------
+// checks the ints that values are rounded to at the edges of the range of int,
+// where values outside it are INT_MIN as the conversion of their double was
+//   (so a bureaucrat promoted by 2^32 moves by INT_MIN, and 2^32 + 65 speaks '\0' rather than 'A')
+int main() {
+  const RoundingCase cases[] = {
+    { RungValue(65), 65 }
+    , { RungValue(-65), -65 }
+    , { RungValue((long long)INT_MAX), INT_MAX }
+    , { RungValue((long long)INT_MIN), INT_MIN }
+    , { RungValue((long long)INT_MAX + 1), INT_MIN }
+    , { RungValue((long long)INT_MAX + 2), INT_MIN }
+    , { RungValue((long long)INT_MIN - 1), INT_MIN }
+    , { RungValue(1LL << 32), INT_MIN }
+    , { RungValue((1LL << 32) + 65), INT_MIN }
+    , { RungValue(-(1LL << 32)), INT_MIN }
+    , { RungValue(RUNG_VALUE_INTEGER_MAX), INT_MIN }
+    , { RungValue(2.5), 3 }
+    , { RungValue(-2.5), -3 }
+    , { RungValue(2147483646.5), INT_MAX }
+    , { RungValue(2147483647.5), INT_MIN }
+    , { RungValue(-2147483648.5), INT_MIN }
+    , { RungValue(4294967361.5), INT_MIN }
+    , { RungValue(1e300), INT_MIN }
+    , { RungValue(-1e300), INT_MIN }
+  };
+  const int numCases = (int)(sizeof(cases) / sizeof(cases[0]));
+  int numFailures = 0;
+  int result;
+
+  for (int i = 0; i < numCases; i++) {
+    result = cases[i].value.toInt_rounded();
+    if (result != cases[i].expected) {
+      cout << "Error: " << cases[i].value << " was rounded to " << result << " (expected " << cases[i].expected << ")" << endl;
+      numFailures++;
+    }
+  }
+
+  // (speak writes the char of the rounded value)
+  if ((char)RungValue((1LL << 32) + 65).toInt_rounded() != '\0') {
+    cout << "Error: 4294967361 was spoken as a char other than '\\0'" << endl;
+    numFailures++;
+  }
+
+  cout << "Values checked: " << numCases << endl;
+  cout << "Failures: " << numFailures << endl;
+
+  return numFailures == 0 ? 0 : 1;
+}
\ No newline at end of file
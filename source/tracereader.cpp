@@ -0,0 +1,71 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdlib>
+
+using namespace std;
+
+#include "ExecutionTrace.h"
+#include "funcs.h"
+
+// shows only the executions of the program itself
+#define NO_VARIABLES_FLAG "-nv"
+
+// displays how the reader is used
+void displayUsage();
+
+//-------------------------------------------------------------------------------
+// main()
+//-------------------------------------------------------------------------------
+int main(int argc, char** argv) {
+  ifstream trace;
+  string filename = EXECUTION_TRACE_FILE_STRING;
+  int firstStep = 0;
+  int lastStep = TRACE_STEP_LAST;
+  bool areVariableExecutionsShown = true;
+  int numSteps = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (lowerCase(argv[i]) == NO_VARIABLES_FLAG) {
+      areVariableExecutionsShown = false;
+    }
+    else if (i == 1) {
+      filename = argv[i];
+    }
+    else if (numSteps < 2) {
+      if (numSteps == 0) {
+        firstStep = atoi(argv[i]);
+      }
+      else {
+        lastStep = atoi(argv[i]);
+      }
+      numSteps++;
+    }
+    else {
+      displayUsage();
+      return 1;
+    }
+  }
+
+  trace.open(filename, ios::binary);
+  if (!trace.is_open()) {
+    cout << "Error: \"" << filename << "\" could not be opened" << endl;
+    return 1;
+  }
+
+  if (!TraceReplayer::replay(trace, cout, firstStep, lastStep, areVariableExecutionsShown)) {
+    cout << "Error: \"" << filename << "\" is not a complete execution trace" << endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+//-------------------------------------------------------------------------------
+// displayUsage()
+//-------------------------------------------------------------------------------
+void displayUsage() {
+  cout << "TraceReader.exe [trace_filename [first_execution [last_execution]]] [" << NO_VARIABLES_FLAG << "]" << endl;
+  cout << "  writes the execution log of the trace from first_execution to last_execution" << endl;
+  cout << "  (" << NO_VARIABLES_FLAG << " leaves out the executions of command variables)" << endl;
+}
\ No newline at end of file